@@ -56,6 +56,15 @@ function(picolibc_sources_flags flags)
   # Add all files that aren't duplicated
   target_sources(c PRIVATE ${sources})
 
+  # Remember the math library sources so they can be built again for libm-fast
+  string(FIND "${CMAKE_CURRENT_SOURCE_DIR}/" "${PROJECT_SOURCE_DIR}/libm/" libm_pos)
+  if(libm_pos EQUAL 0)
+    foreach(source ${sources})
+      get_filename_component(source_path "${source}" ABSOLUTE)
+      set_property(GLOBAL APPEND PROPERTY PICOLIBC_LIBM_SOURCES "${source_path}")
+    endforeach()
+  endif()
+
   # Set flags if specified
   if(flags)
     foreach(flag ${flags})
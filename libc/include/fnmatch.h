@@ -50,6 +50,19 @@
 
 _BEGIN_STD_C
 int fnmatch(const char *, const char *, int) __picolibc_export;
+
+#if __MISC_VISIBLE
+/*
+ * Compile a pattern once and match it against many strings. A
+ * compiled pattern is never modified by fnmatch_exec, so it may be
+ * shared between threads.
+ */
+typedef struct __fnmatch_pattern fnmatch_t;
+
+fnmatch_t *fnmatch_compile(const char *, int) __picolibc_export;
+int        fnmatch_exec(const fnmatch_t *, const char *) __picolibc_export;
+void       fnmatch_free(fnmatch_t *) __picolibc_export;
+#endif
 _END_STD_C
 
 #endif /* !_FNMATCH_H_ */
@@ -104,6 +104,42 @@ void            __malloc_unlock(void) __picolibc_export;
 /* Some systems provide this, so do too for compatibility.  */
 void cfree(void *) __picolibc_export;
 
+#ifdef __MALLOC_PROFILE
+
+/* Heap profiling, enabled with the malloc-profile option */
+
+#define MALLOC_PROFILE_CLASSES 32 /* chunk sizes, by power of two */
+#define MALLOC_PROFILE_LATENCY 16 /* call times, by power of two */
+#define MALLOC_PROFILE_SITES   16 /* most recent sampled allocations */
+#define MALLOC_PROFILE_SAMPLE  32 /* one allocation in this many is sampled */
+
+struct malloc_profile_site {
+    void  *caller; /* return address of the malloc call */
+    size_t size;   /* chunk size allocated */
+};
+
+struct malloc_profile {
+    size_t in_use;                                 /* bytes in allocated chunks */
+    size_t peak;                                   /* largest value of in_use */
+    size_t nmalloc;                                /* successful allocations */
+    size_t nfree;                                  /* chunks returned to the heap */
+    size_t nfail;                                  /* allocations failed by sbrk */
+    size_t size_class[MALLOC_PROFILE_CLASSES];     /* allocations by log2 of size */
+    size_t malloc_latency[MALLOC_PROFILE_LATENCY]; /* malloc calls by log2 of ticks */
+    size_t free_latency[MALLOC_PROFILE_LATENCY];   /* free calls by log2 of ticks */
+    size_t nsite;                                  /* total sampled allocations */
+    struct malloc_profile_site site[MALLOC_PROFILE_SITES];
+};
+
+void          malloc_profile(struct malloc_profile *__profile) __picolibc_export;
+void          malloc_profile_reset(void) __picolibc_export;
+void          malloc_profile_dump(void) __picolibc_export;
+
+/* Define this to have malloc and free latency measured */
+unsigned long __malloc_profile_ticks(void) __picolibc_export;
+
+#endif
+
 _END_STD_C
 
 #endif /* _INCLUDE_MALLOC_H_ */
@@ -40,11 +40,15 @@
 #include <sys/types.h>
 #include <sys/lock.h>
 
-#define __BALL  0x0001 /* bufio buf is allocated by stdio */
-#define __BLBF  0x0002 /* bufio is line buffered */
-#define __BFALL 0x0004 /* FILE is allocated by stdio */
-#define __BFPTR 0x0008 /* funcs need pointers instead of ints */
-#define __BPIPE 0x0010 /* FILE is opened with popen */
+#define __BALL   0x0001 /* bufio buf is allocated by stdio */
+#define __BLBF   0x0002 /* bufio is line buffered */
+#define __BFALL  0x0004 /* FILE is allocated by stdio */
+#define __BFPTR  0x0008 /* funcs need pointers instead of ints */
+#define __BPIPE  0x0010 /* FILE is opened with popen */
+#define __BSEEK  0x0020 /* lseek has succeeded on this FILE */
+#define __BSTALE 0x0040 /* fd offset doesn't match pos, use pread/pwrite */
+
+struct iovec;
 
 union __file_bufio_cookie {
     int   fd;
@@ -81,6 +85,12 @@ struct __file_bufio {
         int (*close_int)(int fd);
         int (*close_ptr)(void *ptr);
     };
+#ifdef __FAST_BUFIO
+    /* optional positional and vectored I/O, fd streams only */
+    ssize_t (*pread_int)(int fd, void *buf, size_t count, __off_t offset);
+    ssize_t (*pwrite_int)(int fd, const void *buf, size_t count, __off_t offset);
+    ssize_t (*writev_int)(int fd, const struct iovec *iov, int iovcnt);
+#endif
 #ifdef __STDIO_BUFIO_LOCKING
     _LOCK_T lock;
 #endif
@@ -89,7 +99,24 @@ struct __file_bufio {
 #endif
 };
 
-#define FDEV_SETUP_BUFIO(_fd, _buf, _size, _read, _write, _lseek, _close, _rwflag, _bflags)        \
+#ifdef __FAST_BUFIO
+#define __FDEV_SETUP_BUFIO_VEC(_pread, _pwrite, _writev) \
+    , .pread_int = (_pread), .pwrite_int = (_pwrite), .writev_int = (_writev)
+#else
+#define __FDEV_SETUP_BUFIO_VEC(_pread, _pwrite, _writev)
+#endif
+
+#define FDEV_SETUP_BUFIO(_fd, _buf, _size, _read, _write, _lseek, _close, _rwflag, _bflags) \
+    FDEV_SETUP_BUFIO_VEC(_fd, _buf, _size, _read, _write, _lseek, _close, NULL, NULL, NULL,  \
+                         _rwflag, _bflags)
+
+/*
+ * With fast-bufio, the pread, pwrite and writev functions let
+ * bufio skip lseek calls and coalesce buffered data with large
+ * writes. Any of them may be NULL.
+ */
+#define FDEV_SETUP_BUFIO_VEC(_fd, _buf, _size, _read, _write, _lseek, _close, _pread, _pwrite,     \
+                             _writev, _rwflag, _bflags)                                            \
     {                                                                                              \
         .xfile = FDEV_SETUP_EXT(__bufio_put, __bufio_get, __bufio_flush,                           \
                                 (_bflags) & (__BALL | __BFALL) ? __bufio_close : __bufio_close_nf, \
@@ -100,6 +127,7 @@ struct __file_bufio {
         {                                                                                          \
             .close_int = _close                                                                    \
         }                                                                                          \
+        __FDEV_SETUP_BUFIO_VEC(_pread, _pwrite, _writev)                                           \
     }
 
 #define FDEV_SETUP_BUFIO_PTR(_ptr, _buf, _size, _read, _write, _lseek, _close, _rwflag, _bflags)   \
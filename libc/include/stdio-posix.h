@@ -37,9 +37,23 @@
 #define _STDIO_POSIX_H_
 
 #include <unistd.h>
+#include <sys/uio.h>
 #include <stdio-bufio.h>
 
-#define FDEV_SETUP_POSIX(fd, buf, size, rwflags, bflags)                        \
-    FDEV_SETUP_BUFIO(fd, buf, size, read, write, lseek, close, rwflags, bflags)
+/*
+ * Without native pread and pwrite, bufio moves the fd offset with lseek
+ * instead; an lseek-based emulation would cost more system calls
+ */
+#ifdef __HAVE_PREAD
+#define __POSIX_PREAD  pread
+#define __POSIX_PWRITE pwrite
+#else
+#define __POSIX_PREAD  NULL
+#define __POSIX_PWRITE NULL
+#endif
+
+#define FDEV_SETUP_POSIX(fd, buf, size, rwflags, bflags)                                        \
+    FDEV_SETUP_BUFIO_VEC(fd, buf, size, read, write, lseek, close, __POSIX_PREAD, __POSIX_PWRITE, \
+                         writev, rwflags, bflags)
 
 #endif /* _STDIO_POSIX_H_ */
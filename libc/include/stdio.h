@@ -130,6 +130,11 @@ struct __file_ext {
     struct __file_close cfile; /* close file struct */
     __off_t             (*seek)(struct __file *, __off_t offset, int whence);
     int                 (*setvbuf)(struct __file *, char *buf, int mode, size_t size);
+#ifdef __FAST_MEMSTREAM
+    /* direct access to a memory backed stream */
+    char               *(*window)(struct __file *, int dir, size_t *len);
+    void                (*advance)(struct __file *, int dir, size_t len);
+#endif
 };
 
 #define FDEV_SETUP_EXT(__put, __get, __flush, __close, __seek, __setvbuf, __flags)     \
@@ -214,6 +219,10 @@ int   fflush(FILE *stream)
 
 #define fdev_close(f) (fflush(f))
 
+/* Read in place from bufio and memory stream buffers */
+const char *__fpeek(FILE *__stream, size_t *__len) __nonnull((1, 2)) __picolibc_export;
+int         __fconsume(FILE *__stream, size_t __n) __nonnull((1)) __picolibc_export;
+
 /* Check for old-style printf selection symbols */
 
 #define __IO_VARIANT_DOUBLE  'd'
@@ -675,6 +684,9 @@ __printf_float(float f)
 #define _HAS_IO_PERCENT_B
 #endif
 #define _HAS_IO_FLOAT
+#ifdef __IO_FLOAT_EXACT
+#define _HAS_IO_SHORTEST
+#endif
 #else /* _PICOLIBC_PRINTF == __IO_VARIANT_DOUBLE */
 #define printf_float(x) ((double)(x))
 #define _HAS_IO_LONG_LONG
@@ -693,6 +705,9 @@ __printf_float(float f)
 #ifdef __IO_LONG_DOUBLE
 #define _HAS_IO_LONG_DOUBLE
 #endif
+#ifdef __IO_FLOAT_EXACT
+#define _HAS_IO_SHORTEST
+#endif
 #endif
 
 _END_STD_C
@@ -304,6 +304,8 @@
 #define __capability(x)                __attribute__((__capability__(x)))
 #define __acquire_capability(x)        __attribute__((__acquire_capability__(x)))
 #define __release_capability(x)        __attribute__((__release_capability__(x)))
+#define __acquire_shared_capability(x) __attribute__((__acquire_shared_capability__(x)))
+#define __release_shared_capability(x) __attribute__((__release_shared_capability__(x)))
 #define __try_acquire_capability(r, x) __attribute__((__try_acquire_capability__(r, x)))
 #define __requires_capability(x)       __attribute__((__requires_capability__(x)))
 #define __guarded_by(x)                __attribute__((__guarded_by__(x)))
@@ -312,6 +314,8 @@
 #define __capability(x)
 #define __acquire_capability(x)
 #define __release_capability(x)
+#define __acquire_shared_capability(x)
+#define __release_shared_capability(x)
 #define __try_acquire_capability(r, x)
 #define __requires_capability(x)
 #define __guarded_by(x)
@@ -10,6 +10,7 @@
 
 #define __LOCK_INIT(lock)
 #define __LOCK_INIT_RECURSIVE(lock)
+#define __LOCK_INIT_OPTIONAL(lock)
 #define __lock_init(lock)              ((void)0)
 #define __lock_init_recursive(lock)    ((void)0)
 #define __lock_close(lock)             ((void)0)
@@ -18,6 +19,8 @@
 #define __lock_acquire_recursive(lock) ((void)0)
 #define __lock_release(lock)           ((void)0)
 #define __lock_release_recursive(lock) ((void)0)
+#define __lock_acquire_shared(lock)    ((void)0)
+#define __lock_release_shared(lock)    ((void)0)
 
 #else
 
@@ -30,6 +33,7 @@ typedef struct __lock *_LOCK_T;
 
 #define __LOCK_INIT(lock)              extern struct __lock __lock_##lock;
 #define __LOCK_INIT_RECURSIVE(lock)    __LOCK_INIT(lock)
+#define __LOCK_INIT_OPTIONAL(lock)     extern struct __lock __lock_##lock __weak;
 
 void                   __retarget_lock_init(_LOCK_T *lock);
 void                   __retarget_lock_init_recursive(_LOCK_T *lock);
@@ -40,6 +44,17 @@ void                   __retarget_lock_acquire_recursive(_LOCK_T lock) __acquire
 void                   __retarget_lock_release(_LOCK_T lock) __release_capability(lock);
 void                   __retarget_lock_release_recursive(_LOCK_T lock) __release_capability(lock);
 
+/*
+ * Optional reader/writer support. When the locking implementation
+ * provides these, readers of a lock that has them (currently just the
+ * environment lock) acquire it shared while writers continue to use
+ * __retarget_lock_acquire_recursive, which must then exclude readers.
+ */
+void __retarget_lock_acquire_shared(_LOCK_T lock) __weak __acquire_shared_capability(lock);
+void __retarget_lock_release_shared(_LOCK_T lock) __weak __release_shared_capability(lock);
+
+extern struct __lock __lock___libc_recursive_mutex;
+
 #define __lock_init(lock)              __retarget_lock_init(&lock)
 #define __lock_init_recursive(lock)    __retarget_lock_init_recursive(&lock)
 #define __lock_close(lock)             __retarget_lock_close(lock)
@@ -49,6 +64,30 @@ void                   __retarget_lock_release_recursive(_LOCK_T lock) __release
 #define __lock_release(lock)           __retarget_lock_release(lock)
 #define __lock_release_recursive(lock) __retarget_lock_release_recursive(lock)
 
+/*
+ * Map an optional lock to the global lock when the locking
+ * implementation doesn't define it.
+ */
+#define __lock_optional(lock)          (&(lock) ? &(lock) : &__lock___libc_recursive_mutex)
+
+static __inline void __no_thread_safety_analysis
+__lock_acquire_shared(_LOCK_T lock)
+{
+    if (lock != &__lock___libc_recursive_mutex && __retarget_lock_acquire_shared)
+        __retarget_lock_acquire_shared(lock);
+    else
+        __retarget_lock_acquire_recursive(lock);
+}
+
+static __inline void __no_thread_safety_analysis
+__lock_release_shared(_LOCK_T lock)
+{
+    if (lock != &__lock___libc_recursive_mutex && __retarget_lock_release_shared)
+        __retarget_lock_release_shared(lock);
+    else
+        __retarget_lock_release_recursive(lock);
+}
+
 _END_STD_C
 
 #endif /* !defined(__SINGLE_THREAD) */
@@ -57,4 +96,43 @@ _END_STD_C
 #define __LIBC_UNLOCK() __lock_release_recursive(&__lock___libc_recursive_mutex)
 __LOCK_INIT_RECURSIVE(__libc_recursive_mutex)
 
+/*
+ * Per-subsystem locks. Each of these is optional: a locking
+ * implementation which doesn't define one gets the global lock in its
+ * place, so unrelated subsystems only run concurrently when the
+ * target asks for it.
+ */
+#define __LIBC_SUBSYS_LOCK(lock)     __lock_acquire_recursive(__lock_optional(__lock_##lock))
+#define __LIBC_SUBSYS_UNLOCK(lock)   __lock_release_recursive(__lock_optional(__lock_##lock))
+
+#define __MALLOC_LOCK()              __LIBC_SUBSYS_LOCK(__malloc_recursive_mutex)
+#define __MALLOC_UNLOCK()            __LIBC_SUBSYS_UNLOCK(__malloc_recursive_mutex)
+__LOCK_INIT_OPTIONAL(__malloc_recursive_mutex)
+
+#define __ENV_LOCK()                 __LIBC_SUBSYS_LOCK(__env_recursive_mutex)
+#define __ENV_UNLOCK()               __LIBC_SUBSYS_UNLOCK(__env_recursive_mutex)
+#define __ENV_LOCK_SHARED()          __lock_acquire_shared(__lock_optional(__lock___env_recursive_mutex))
+#define __ENV_UNLOCK_SHARED()        __lock_release_shared(__lock_optional(__lock___env_recursive_mutex))
+__LOCK_INIT_OPTIONAL(__env_recursive_mutex)
+
+#define __TZ_LOCK()                  __LIBC_SUBSYS_LOCK(__tz_mutex)
+#define __TZ_UNLOCK()                __LIBC_SUBSYS_UNLOCK(__tz_mutex)
+__LOCK_INIT_OPTIONAL(__tz_mutex)
+
+#define __ATEXIT_LOCK()              __LIBC_SUBSYS_LOCK(__atexit_recursive_mutex)
+#define __ATEXIT_UNLOCK()            __LIBC_SUBSYS_UNLOCK(__atexit_recursive_mutex)
+__LOCK_INIT_OPTIONAL(__atexit_recursive_mutex)
+
+#define __AT_QUICK_EXIT_LOCK()       __LIBC_SUBSYS_LOCK(__at_quick_exit_mutex)
+#define __AT_QUICK_EXIT_UNLOCK()     __LIBC_SUBSYS_UNLOCK(__at_quick_exit_mutex)
+__LOCK_INIT_OPTIONAL(__at_quick_exit_mutex)
+
+#define __ARC4RANDOM_LOCK()          __LIBC_SUBSYS_LOCK(__arc4random_mutex)
+#define __ARC4RANDOM_UNLOCK()        __LIBC_SUBSYS_UNLOCK(__arc4random_mutex)
+__LOCK_INIT_OPTIONAL(__arc4random_mutex)
+
+#define __SFP_LOCK()                 __LIBC_SUBSYS_LOCK(__sfp_recursive_mutex)
+#define __SFP_UNLOCK()               __LIBC_SUBSYS_UNLOCK(__sfp_recursive_mutex)
+__LOCK_INIT_OPTIONAL(__sfp_recursive_mutex)
+
 #endif /* __SYS_LOCK_H__ */
@@ -239,6 +239,9 @@ int pipe2(int __fildes[2], int flags) __picolibc_export;
 ssize_t pread(int __fd, void *__buf, size_t __nbytes, off_t __offset) __picolibc_export;
 ssize_t pwrite(int __fd, const void *__buf, size_t __nbytes, off_t __offset) __picolibc_export;
 #endif
+ssize_t __fallback_pread(int __fd, void *__buf, size_t __nbytes, off_t __offset) __picolibc_export;
+ssize_t __fallback_pwrite(int __fd, const void *__buf, size_t __nbytes,
+                          off_t __offset) __picolibc_export;
 ssize_t read(int __fd, void *__buf, size_t __nbyte) __picolibc_export;
 #if __BSD_VISIBLE
 int rresvport(int *__alport) __picolibc_export;
@@ -65,9 +65,22 @@ single-threaded application to link successfully out of the box on bare-metal
 systems.
 
 For multi-threaded applications the target platform is required to provide
-an implementation for @strong{all} these routines and static locks.  If some
-routines or static locks are missing, the link will fail with doubly defined
-symbols.
+an implementation for @strong{all} these routines and
+<<__lock___libc_recursive_mutex>>.  If some routines are missing, the link
+will fail with doubly defined symbols.
+
+The per-subsystem static locks are optional.  Each one that the target
+platform defines lets the matching part of the library (malloc, the
+environment, timezone data, atexit, at_quick_exit, arc4random and the
+stdio file list) run without contending on the global lock; any which are
+left undefined fall back to <<__lock___libc_recursive_mutex>>.  All of
+them are acquired with the recursive routines.
+
+A target may additionally provide <<__retarget_lock_acquire_shared>> and
+<<__retarget_lock_release_shared>>, which <<getenv>> uses to take
+<<__lock___env_recursive_mutex>> for reading so that concurrent lookups
+don't serialize.  Writers still use <<__retarget_lock_acquire_recursive>>
+on that lock, which must then exclude shared holders.
 
 PORTABILITY
 These locking routines and static lock are newlib-specific.  Supporting OS
@@ -90,6 +90,11 @@ static char  *backref(struct match *m, char *start, char *stop, sopno startst, s
 static char  *fast(struct match *m, char *start, char *stop, sopno startst, sopno stopst);
 static char  *slow(struct match *m, char *start, char *stop, sopno startst, sopno stopst);
 static states step(struct re_guts *g, sopno start, sopno stop, states bef, int ch, states aft);
+#ifdef SNAMES
+static char *dfast(struct match *m, char *start, char *stop);
+static int   dfainit(struct re_guts *g, struct re_dfa *d);
+static int   dfastate(struct re_guts *g, struct re_dfa *d, states st);
+#endif
 #define BOL        (OUT + 1)
 #define EOL        (BOL + 1)
 #define BOLEOL     (BOL + 2)
@@ -198,11 +203,8 @@ matcher(struct re_guts *g, char *string, size_t nmatch, regmatch_t pmatch[], int
             if (pp != mustfirst)
                 return (REG_NOMATCH);
         } else {
-            for (dp = start; dp < stop; dp++)
-                if (g->must && *dp == g->must[0] && stop - dp >= g->mlen
-                    && memcmp(dp, g->must, (size_t)g->mlen) == 0)
-                    break;
-            if (dp == stop) /* we didn't find g->must */
+            dp = memmem(start, stop - start, g->must, (size_t)g->mlen);
+            if (dp == NULL) /* we didn't find g->must */
                 return (REG_NOMATCH);
         }
     }
@@ -228,7 +230,12 @@ matcher(struct re_guts *g, char *string, size_t nmatch, regmatch_t pmatch[], int
 
     /* this loop does only one repetition except for backrefs */
     for (;;) {
-        endp = fast(m, start, stop, gf, gl);
+#ifdef SNAMES
+        if (g->dfa != NULL)
+            endp = dfast(m, start, stop);
+        else
+#endif
+            endp = fast(m, start, stop, gf, gl);
         if (endp == NULL) { /* a miss */
             STATETEARDOWN(m);
             return (REG_NOMATCH);
@@ -790,6 +797,229 @@ fast(struct match *m, char *start, char *stop, sopno startst, sopno stopst)
         return (NULL);
 }
 
+#ifdef SNAMES
+/*
+ * The lock is only held while DFA states are added. Scans read the
+ * transition table without it: an entry changes just once, from
+ * DFA_UNKNOWN to a state whose set, flags and row were filled in
+ * first, and the table is only flushed when no other scan is running.
+ */
+#ifdef __SINGLE_THREAD
+#define DFA_LOAD(p)     (*(p))
+#define DFA_STORE(p, v) (*(p) = (v))
+#else
+#include <stdatomic.h>
+#define DFA_LOAD(p)     atomic_load_explicit((_Atomic uch *)(p), memory_order_acquire)
+#define DFA_STORE(p, v) atomic_store_explicit((_Atomic uch *)(p), (uch)(v), memory_order_release)
+#endif
+
+/*
+ - dfast - fast() using the cached DFA
+ == static char *dfast(struct match *m, char *start, char *stop);
+ *
+ * Computes exactly what fast() does for g->firststate + 1 through
+ * g->laststate, but looks each character up in the DFA transition
+ * table instead of running step() over the whole strip.  Anchors are
+ * still handled by step() as they are rare.
+ */
+static char * /* where tentative match ended, or NULL */
+dfast(struct match *m, char *start, char *stop)
+{
+    struct re_guts *g = m->g;
+    struct re_dfa  *d = g->dfa;
+    const sopno     gf = g->firststate + 1;
+    const sopno     gl = g->laststate;
+    char           *p = start;
+    int             c = (start == m->beginp) ? OUT : *(start - 1);
+    int             lastc; /* previous c */
+    int             flagch;
+    int             i;
+    char           *coldp = NULL; /* last p after which no match was underway */
+    int             s;             /* current DFA state */
+    int             ns;            /* next DFA state */
+    int             k;             /* character class of c */
+    int             n;
+    states          st;
+
+    __lock_acquire(d->lock);
+    if (d->sets == NULL && dfainit(g, d) < 0) {
+        __lock_release(d->lock);
+        return fast(m, start, stop, gf, gl);
+    }
+    d->users++;
+    s = dfastate(g, d, d->fresh);
+    __lock_release(d->lock);
+    if (s < 0)
+        goto full;
+    for (;;) {
+        /* next character */
+        lastc = c;
+        c = (p == m->endp) ? OUT : *p;
+        if (d->flags[s] & DFA_FRESH)
+            coldp = p;
+
+        /* is there an EOL and/or BOL between lastc and c? */
+        if (g->nbol + g->neol != 0) {
+            flagch = '\0';
+            i = 0;
+            if ((lastc == '\n' && g->cflags & REG_NEWLINE)
+                || (lastc == OUT && !(m->eflags & REG_NOTBOL))) {
+                flagch = BOL;
+                i = g->nbol;
+            }
+            if ((c == '\n' && g->cflags & REG_NEWLINE)
+                || (c == OUT && !(m->eflags & REG_NOTEOL))) {
+                flagch = (flagch == BOL) ? BOLEOL : EOL;
+                i += g->neol;
+            }
+            if (i != 0) {
+                st = d->sets[s];
+                for (; i > 0; i--)
+                    st = step(g, gf, gl, st, flagch, st);
+                __lock_acquire(d->lock);
+                s = dfastate(g, d, st);
+                __lock_release(d->lock);
+                if (s < 0)
+                    goto full;
+            }
+        }
+
+        /* are we done? */
+        if ((d->flags[s] & DFA_ACCEPT) || p == stop)
+            break; /* NOTE BREAK OUT */
+
+        /* no, we must deal with this character */
+        assert(c != OUT);
+        k = d->classes[(uch)c];
+        ns = DFA_LOAD(&d->trans[s * d->nclasses + k]);
+        if (ns == DFA_UNKNOWN) {
+            st = step(g, gf, gl, d->sets[s], (char)d->reps[k], d->fresh);
+            __lock_acquire(d->lock);
+            n = d->nstates;
+            ns = dfastate(g, d, st);
+            /* don't record a transition from a state that was just flushed */
+            if (ns >= 0 && d->nstates >= n)
+                DFA_STORE(&d->trans[s * d->nclasses + k], ns);
+            __lock_release(d->lock);
+            if (ns < 0)
+                goto full;
+        }
+        s = ns;
+        p++;
+    }
+
+    assert(coldp != NULL);
+    m->coldp = coldp;
+    i = d->flags[s] & DFA_ACCEPT;
+    __lock_acquire(d->lock);
+    d->users--;
+    __lock_release(d->lock);
+    if (i)
+        return (p + 1);
+    else
+        return (NULL);
+
+full:
+    /* the table is full and in use elsewhere, start over without it */
+    __lock_acquire(d->lock);
+    d->users--;
+    __lock_release(d->lock);
+    return fast(m, start, stop, gf, gl);
+}
+
+/*
+ - dfainit - compute character classes and allocate the DFA tables
+ == static int dfainit(struct re_guts *g, struct re_dfa *d);
+ *
+ * Two characters are in the same class when every OCHAR and OANYOF
+ * operator in the strip treats them alike; step() can't distinguish
+ * them, so they share a column of the transition table.
+ */
+static int /* 0 success, -1 out of memory */
+dfainit(struct re_guts *g, struct re_dfa *d)
+{
+    const sopno gf = g->firststate + 1;
+    const sopno gl = g->laststate;
+    uch         classes[NC];
+    short       remap[NC][2];
+    int         nclasses = 1;
+    int         c, n, in;
+    cset       *cs;
+    sop        *scan;
+    sop         s;
+    char       *space;
+    states      st;
+
+    memset(classes, 0, sizeof(classes));
+    scan = g->strip + 1;
+    do {
+        s = *scan++;
+        if (OP(s) != OCHAR && OP(s) != OANYOF)
+            continue;
+        cs = (OP(s) == OANYOF) ? &g->sets[OPND(s)] : NULL;
+        for (c = 0; c < nclasses; c++)
+            remap[c][0] = remap[c][1] = -1;
+        n = 0;
+        for (c = 0; c < NC; c++) {
+            in = cs ? CHIN(cs, c) != 0 : (uch)c == (uch)OPND(s);
+            if (remap[classes[c]][in] < 0)
+                remap[classes[c]][in] = n++;
+            classes[c] = remap[classes[c]][in];
+        }
+        nclasses = n;
+    } while (OP(s) != OEND);
+
+    space = malloc(DFA_NSTATES * sizeof(long) + NC + nclasses + DFA_NSTATES
+                   + DFA_NSTATES * nclasses);
+    if (space == NULL)
+        return (-1);
+    d->sets = (long *)space;
+    d->classes = (uch *)(d->sets + DFA_NSTATES);
+    d->reps = d->classes + NC;
+    d->flags = d->reps + nclasses;
+    d->trans = d->flags + DFA_NSTATES;
+    d->nclasses = nclasses;
+    d->nstates = 0;
+    memcpy(d->classes, classes, NC);
+    for (c = NC; c-- > 0;)
+        d->reps[classes[c]] = c;
+
+    CLEAR(st);
+    SET1(st, gf);
+    d->fresh = step(g, gf, gl, st, NOTHING, st);
+    return (0);
+}
+
+/*
+ - dfastate - find or create the DFA state for a set of strip states
+ == static int dfastate(struct re_guts *g, struct re_dfa *d, states st);
+ *
+ * Called with the lock held.  When the table is full and no other scan
+ * is using it, everything is thrown away and rebuilt as needed; any
+ * state number held by the caller is then stale.  If another scan is
+ * running, the table is left alone and -1 is returned.
+ */
+static int
+dfastate(struct re_guts *g, struct re_dfa *d, states st)
+{
+    int i;
+
+    for (i = 0; i < d->nstates; i++)
+        if (EQ(d->sets[i], st))
+            return (i);
+    if (d->nstates == DFA_NSTATES) {
+        if (d->users > 1)
+            return (-1);
+        d->nstates = 0;
+    }
+    i = d->nstates++;
+    d->sets[i] = st;
+    d->flags[i] = (ISSET(st, g->laststate) ? DFA_ACCEPT : 0) | (EQ(st, d->fresh) ? DFA_FRESH : 0);
+    memset(&d->trans[i * d->nclasses], DFA_UNKNOWN, d->nclasses);
+    return (i);
+}
+#endif
+
 /*
  - slow - step through the string more deliberately
  == static char *slow(struct match *m, char *start, \
@@ -52,33 +52,26 @@ enum gr_id {
     gr_count,
 };
 
+/*
+ * Split a NUL-terminated group line, which must lie within buf, into
+ * grbuf. The space in buf following the line holds the gr_mem array.
+ */
 int
-fgetgrent_r(FILE *stream, struct group *grbuf, char *buf, size_t size, struct group **grbufp)
+__grent_parse(char *line, char *buf, size_t size, struct group *grbuf)
 {
-    char      *line;
-    char      *nl;
     char      *token, *mem;
     enum gr_id id;
     char     **gr_memp;
     size_t     n_gr_mem;
 
-    errno = 0;
-    line = fgets(buf, size, stream);
-    if (!line) {
-        *grbufp = NULL;
-        if (errno == 0)
-            errno = ENOENT;
-        return errno;
-    }
-    nl = strchrnul(line, '\n');
-    *nl = '\0';
-
     /* Use the rest of the buffer for pointers to group members */
-    gr_memp = (char **)__align_up(nl + 1, sizeof(*gr_memp));
+    gr_memp = (char **)__align_up(line + strlen(line) + 1, sizeof(*gr_memp));
+    if ((char *)gr_memp >= buf + size)
+        return ERANGE;
     n_gr_mem = ((buf + size) - (char *)gr_memp) / sizeof(*gr_memp);
 
     if (n_gr_mem == 0)
-        return (errno = ERANGE);
+        return ERANGE;
 
     id = gr_name;
 
@@ -107,7 +100,7 @@ fgetgrent_r(FILE *stream, struct group *grbuf, char *buf, size_t size, struct gr
                     n_gr_mem--;
                 }
                 if (mem)
-                    return (errno = ERANGE);
+                    return ERANGE;
                 *gr_memp = NULL;
                 break;
             case gr_count:
@@ -122,7 +115,30 @@ fgetgrent_r(FILE *stream, struct group *grbuf, char *buf, size_t size, struct gr
         id++;
     }
     if (id != gr_count)
-        return (errno = EINVAL);
+        return EINVAL;
+    return 0;
+}
+
+int
+fgetgrent_r(FILE *stream, struct group *grbuf, char *buf, size_t size, struct group **grbufp)
+{
+    char *line;
+    char *nl;
+    int   ret;
+
+    errno = 0;
+    line = fgets(buf, size, stream);
+    if (!line) {
+        *grbufp = NULL;
+        if (errno == 0)
+            errno = ENOENT;
+        return errno;
+    }
+    nl = strchrnul(line, '\n');
+    *nl = '\0';
+    ret = __grent_parse(line, buf, size, grbuf);
+    if (ret)
+        return (errno = ret);
     *grbufp = grbuf;
     return 0;
 }
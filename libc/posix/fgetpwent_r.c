@@ -42,6 +42,7 @@
 #include <stddef.h>
 #include <string.h>
 #include <stdlib.h>
+#include "local-pwd.h"
 
 enum pw_id {
     pw_name,
@@ -70,26 +71,18 @@ pw_is_numeric(enum pw_id state)
     return state == pw_uid || state == pw_gid;
 }
 
+/*
+ * Split a NUL-terminated passwd line into pwbuf. The string fields
+ * point into line.
+ */
 int
-fgetpwent_r(FILE *stream, struct passwd *pwbuf, char *buf, size_t size, struct passwd **pwbufp)
+__pwent_parse(char *line, struct passwd *pwbuf)
 {
-    char      *line;
-    char      *nl;
     char      *token;
     enum pw_id id;
     ptrdiff_t  offset;
     void      *ptr;
 
-    errno = 0;
-    line = fgets(buf, size, stream);
-    if (!line) {
-        *pwbufp = NULL;
-        if (errno == 0)
-            errno = ENOENT;
-        return errno;
-    }
-    if ((nl = strchr(line, '\n')) != NULL)
-        *nl = '\0';
     id = pw_name;
 
     /*
@@ -115,7 +108,30 @@ fgetpwent_r(FILE *stream, struct passwd *pwbuf, char *buf, size_t size, struct p
         }
     }
     if (id != pw_count)
-        return (errno = EINVAL);
+        return EINVAL;
+    return 0;
+}
+
+int
+fgetpwent_r(FILE *stream, struct passwd *pwbuf, char *buf, size_t size, struct passwd **pwbufp)
+{
+    char *line;
+    char *nl;
+    int   ret;
+
+    errno = 0;
+    line = fgets(buf, size, stream);
+    if (!line) {
+        *pwbufp = NULL;
+        if (errno == 0)
+            errno = ENOENT;
+        return errno;
+    }
+    if ((nl = strchr(line, '\n')) != NULL)
+        *nl = '\0';
+    ret = __pwent_parse(line, pwbuf);
+    if (ret)
+        return (errno = ret);
     *pwbufp = pwbuf;
     return 0;
 }
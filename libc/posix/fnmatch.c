@@ -40,7 +40,13 @@
 #include <fnmatch.h>
 #include <string.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <limits.h>
+#include <stdint.h>
+#include <sys/lock.h>
 #include "collate.h"
+#include "locale_private.h"
 
 #define EOS           '\0'
 
@@ -158,10 +164,382 @@ _fnmatch(const char *pattern, const char *string, int flags, int level)
 }
 
 /* Limit recursion to 16 levels to avoid stack overflow */
+#define FNM_LEVELS 16
+
+/*
+ * A compiled pattern is a sequence of operations, one per pattern
+ * element, with adjacent literal characters merged so they can be
+ * compared with memcmp and bracket expressions evaluated once for every
+ * character into a bitmap. fnm_exec walks the operations exactly as
+ * _fnmatch walks the pattern, so the two always agree.
+ */
+enum fnm_op_type {
+    FNM_OP_END,        /* end of pattern */
+    FNM_OP_LIT,        /* literal characters */
+    FNM_OP_ANY,        /* ? */
+    FNM_OP_SET,        /* [...] */
+    FNM_OP_STAR,       /* one or more * */
+    FNM_OP_STAR_SLASH, /* * followed by / with FNM_PATHNAME */
+    FNM_OP_FAIL,       /* [...] which can never match */
+};
+
+struct fnm_op {
+    enum fnm_op_type     type;
+    size_t               len;  /* FNM_OP_LIT: number of characters */
+    const unsigned char *data; /* FNM_OP_LIT: characters, FNM_OP_SET: bitmap */
+};
+
+struct __fnmatch_pattern {
+    int           flags;
+    int           refs;    /* references held by fnmatch and its cache */
+    unsigned      hits;    /* recent cache hits */
+    uint32_t      hash;    /* hash of pattern and flags */
+    locale_t      locale;  /* locale used to compile the pattern */
+    const char   *pattern; /* copy of the source pattern */
+    struct fnm_op ops[];
+};
+
+#define FNM_SET_BYTES ((UCHAR_MAX + 1) / 8)
+
+fnmatch_t *
+fnmatch_compile(const char *pattern, int flags)
+{
+    size_t               len = strlen(pattern);
+    size_t               nset = 0;
+    const char          *p;
+    fnmatch_t           *fp;
+    struct fnm_op       *op;
+    unsigned char       *data;
+    unsigned char       *set;
+    char                *newp;
+    char                 c;
+    int                  b;
+
+    for (p = pattern; *p; p++)
+        if (*p == '[')
+            nset++;
+
+    fp = malloc(sizeof(*fp) + (len + 1) * sizeof(struct fnm_op) + len + nset * FNM_SET_BYTES
+                + len + 1);
+    if (!fp)
+        return NULL;
+    fp->flags = flags;
+    fp->refs = 1;
+    fp->hits = 0;
+    fp->hash = 0;
+    fp->locale = __get_current_locale();
+    op = fp->ops;
+    data = (unsigned char *)(fp->ops + len + 1);
+    fp->pattern = memcpy(data + len + nset * FNM_SET_BYTES, pattern, len + 1);
+
+    /* Parse the pattern just like _fnmatch does */
+    for (p = pattern;;) {
+        switch (c = *p++) {
+        case EOS:
+            op->type = FNM_OP_END;
+            return fp;
+        case '?':
+            op->type = FNM_OP_ANY;
+            op++;
+            break;
+        case '*':
+            while (*p == '*')
+                p++;
+            op->type = (*p == '/' && (flags & FNM_PATHNAME)) ? FNM_OP_STAR_SLASH : FNM_OP_STAR;
+            op++;
+            break;
+        case '[':
+            /* rangematch's walk over the bracket doesn't depend on the test character */
+            newp = NULL;
+            switch (rangematch(p, 1, flags, &newp)) {
+            case RANGE_ERROR:
+                goto norm;
+            case RANGE_NOMATCH:
+                if (newp == NULL) {
+                    /* A '/' in the bracket with FNM_PATHNAME */
+                    op->type = FNM_OP_FAIL;
+                    op[1].type = FNM_OP_END;
+                    return fp;
+                }
+                break;
+            }
+            set = data;
+            data += FNM_SET_BYTES;
+            memset(set, 0, FNM_SET_BYTES);
+            for (b = 1; b <= UCHAR_MAX; b++)
+                if (rangematch(p, (char)b, flags, &newp) == RANGE_MATCH)
+                    set[b >> 3] |= 1 << (b & 7);
+            p = newp;
+            op->type = FNM_OP_SET;
+            op->data = set;
+            op++;
+            break;
+        case '\\':
+            if (!(flags & FNM_NOESCAPE)) {
+                if ((c = *p++) == EOS) {
+                    c = '\\';
+                    --p;
+                }
+            }
+            __fallthrough;
+        default:
+        norm:
+            if (op == fp->ops || op[-1].type != FNM_OP_LIT) {
+                op->type = FNM_OP_LIT;
+                op->len = 0;
+                op->data = data;
+                op++;
+            }
+            /* Literal runs are contiguous, so the previous run can grow */
+            *data++ = (flags & FNM_CASEFOLD) ? tolower((unsigned char)c) : (unsigned char)c;
+            op[-1].len++;
+            break;
+        }
+    }
+}
+
+static bool
+fnm_period(const char *string, const char *stringstart, int flags)
+{
+    return *string == '.' && (flags & FNM_PERIOD)
+        && (string == stringstart || ((flags & FNM_PATHNAME) && *(string - 1) == '/'));
+}
+
+static int
+fnm_exec(const struct fnm_op *op, const char *string, const char *end, int flags, int level)
+{
+    const char *stringstart = string;
+    const char *stop;
+    size_t      i;
+    int         ret;
+
+    for (;; op++) {
+        switch (op->type) {
+        case FNM_OP_END:
+            if ((flags & FNM_LEADING_DIR) && *string == '/')
+                return (0);
+            return (*string == EOS ? 0 : FNM_NOMATCH);
+        case FNM_OP_LIT:
+            if ((size_t)(end - string) < op->len)
+                return (FNM_NOMATCH);
+            if (flags & FNM_CASEFOLD) {
+                for (i = 0; i < op->len; i++)
+                    if (tolower((unsigned char)string[i]) != op->data[i])
+                        return (FNM_NOMATCH);
+            } else if (memcmp(string, op->data, op->len) != 0) {
+                return (FNM_NOMATCH);
+            }
+            string += op->len;
+            break;
+        case FNM_OP_ANY:
+        case FNM_OP_SET:
+        case FNM_OP_FAIL:
+            if (*string == EOS)
+                return (FNM_NOMATCH);
+            if (*string == '/' && (flags & FNM_PATHNAME))
+                return (FNM_NOMATCH);
+            if (fnm_period(string, stringstart, flags))
+                return (FNM_NOMATCH);
+            if (op->type == FNM_OP_FAIL)
+                return (FNM_NOMATCH);
+            if (op->type == FNM_OP_SET) {
+                unsigned char c = (unsigned char)*string;
+                if (!(op->data[c >> 3] & (1 << (c & 7))))
+                    return (FNM_NOMATCH);
+            }
+            ++string;
+            break;
+        case FNM_OP_STAR:
+        case FNM_OP_STAR_SLASH:
+            if (fnm_period(string, stringstart, flags))
+                return (FNM_NOMATCH);
+
+            /* Optimize for pattern with * at end or before /. */
+            if (op[1].type == FNM_OP_END) {
+                if (flags & FNM_PATHNAME)
+                    return ((flags & FNM_LEADING_DIR) || memchr(string, '/', end - string) == NULL
+                                ? 0
+                                : FNM_NOMATCH);
+                return (0);
+            }
+            if (op->type == FNM_OP_STAR_SLASH) {
+                if ((string = memchr(string, '/', end - string)) == NULL)
+                    return (FNM_NOMATCH);
+                break;
+            }
+
+            if (level == 0)
+                return (-FNM_NOMATCH);
+
+            /*
+             * General case, use recursion. With FNM_PATHNAME, the
+             * star can't match past the next '/'.
+             */
+            stop = end;
+            if (flags & FNM_PATHNAME) {
+                stop = memchr(string, '/', end - string);
+                stop = stop ? stop + 1 : end;
+            }
+            while (string < stop) {
+                /* Skip positions where a literal can't start */
+                if (op[1].type == FNM_OP_LIT && !(flags & FNM_CASEFOLD)) {
+                    string = memchr(string, op[1].data[0], stop - string);
+                    if (string == NULL)
+                        break;
+                }
+                ret = fnm_exec(op + 1, string, end, flags & ~FNM_PERIOD, level - 1);
+                if (ret != FNM_NOMATCH)
+                    return (ret);
+                ++string;
+            }
+            return (FNM_NOMATCH);
+        }
+    }
+}
+
+int
+fnmatch_exec(const fnmatch_t *fp, const char *string)
+{
+    return fnm_exec(fp->ops, string, string + strlen(string), fp->flags, FNM_LEVELS);
+}
+
+void
+fnmatch_free(fnmatch_t *fp)
+{
+    free(fp);
+}
+
+#if !defined(__PREFER_SIZE_OVER_SPEED) && !defined(__OPTIMIZE_SIZE__)
+/*
+ * fnmatch keeps a few frequently used patterns in compiled form.
+ * Compiling costs more than interpreting a pattern once, so a pattern
+ * is only compiled after it has missed the cache more often than the
+ * least used entry has been hit. Patterns used once never get
+ * compiled, and a set of patterns slightly larger than the cache
+ * doesn't keep replacing entries. Each miss ages the least used entry
+ * so that patterns which fall out of use are eventually replaced.
+ *
+ * Entries are reference counted so that one thread can keep using a
+ * pattern while another replaces it in the cache.
+ */
+#define FNM_CACHE_SIZE 8
+#define FNM_SEEN_SIZE  16
+#define FNM_HITS_MAX   16
+
+static fnmatch_t *fnm_cache[FNM_CACHE_SIZE];
+
+/* Miss counts for patterns not in the cache, indexed by hash */
+static struct {
+    uint32_t hash;
+    unsigned count;
+} fnm_seen[FNM_SEEN_SIZE];
+
+static uint32_t
+fnm_hash(const char *pattern, int flags)
+{
+    uint32_t hash = 2166136261U ^ (uint32_t)flags;
+
+    while (*pattern)
+        hash = (hash ^ (unsigned char)*pattern++) * 16777619U;
+    return hash;
+}
+
+static unsigned
+fnm_cache_victim(void)
+{
+    unsigned i, v = 0;
+
+    for (i = 0; i < FNM_CACHE_SIZE; i++) {
+        if (!fnm_cache[i])
+            return i;
+        if (fnm_cache[i]->hits < fnm_cache[v]->hits)
+            v = i;
+    }
+    return v;
+}
+
+static fnmatch_t *
+fnm_cache_get(const char *pattern, int flags)
+{
+    locale_t   locale = __get_current_locale();
+    uint32_t   hash = fnm_hash(pattern, flags);
+    fnmatch_t *fp, *old = NULL;
+    unsigned   i, count;
+
+    __LIBC_LOCK();
+    for (i = 0; i < FNM_CACHE_SIZE; i++) {
+        fp = fnm_cache[i];
+        if (fp && fp->hash == hash && fp->flags == flags && fp->locale == locale
+            && !strcmp(fp->pattern, pattern)) {
+            fp->refs++;
+            if (fp->hits < FNM_HITS_MAX)
+                fp->hits++;
+            __LIBC_UNLOCK();
+            return fp;
+        }
+    }
+
+    i = hash % FNM_SEEN_SIZE;
+    if (fnm_seen[i].hash != hash) {
+        fnm_seen[i].hash = hash;
+        fnm_seen[i].count = 0;
+    }
+    if (fnm_seen[i].count < FNM_HITS_MAX)
+        fnm_seen[i].count++;
+    count = fnm_seen[i].count;
+    fp = fnm_cache[fnm_cache_victim()];
+    if (count < 2 || (fp && count <= fp->hits)) {
+        if (fp && fp->hits)
+            fp->hits--;
+        __LIBC_UNLOCK();
+        return NULL;
+    }
+    fnm_seen[i].count = 0;
+    __LIBC_UNLOCK();
+
+    fp = fnmatch_compile(pattern, flags);
+    if (!fp)
+        return NULL;
+
+    __LIBC_LOCK();
+    fp->refs = 2;
+    fp->hits = count;
+    fp->hash = hash;
+    i = fnm_cache_victim();
+    if (fnm_cache[i] && --fnm_cache[i]->refs == 0)
+        old = fnm_cache[i];
+    fnm_cache[i] = fp;
+    __LIBC_UNLOCK();
+    free(old);
+    return fp;
+}
+
+static void
+fnm_cache_put(fnmatch_t *fp)
+{
+    int refs;
+
+    __LIBC_LOCK();
+    refs = --fp->refs;
+    __LIBC_UNLOCK();
+    if (refs == 0)
+        free(fp);
+}
+#endif
+
 int
 fnmatch(const char *pattern, const char *string, int flags)
 {
-    return _fnmatch(pattern, string, flags, 16);
+#if !defined(__PREFER_SIZE_OVER_SPEED) && !defined(__OPTIMIZE_SIZE__)
+    fnmatch_t *fp = fnm_cache_get(pattern, flags);
+
+    if (fp) {
+        int ret = fnmatch_exec(fp, string);
+        fnm_cache_put(fp);
+        return ret;
+    }
+#endif
+    return _fnmatch(pattern, string, flags, FNM_LEVELS);
 }
 
 static const struct {
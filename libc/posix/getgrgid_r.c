@@ -39,6 +39,8 @@
 #include <grp.h>
 #include <string.h>
 #include <errno.h>
+#include "local-grp.h"
+#include "local-pwgr-cache.h"
 
 int
 getgrgid_r(gid_t gid, struct group *grbuf, char *buf, size_t size, struct group **grbufp)
@@ -47,6 +49,17 @@ getgrgid_r(gid_t gid, struct group *grbuf, char *buf, size_t size, struct group
     struct group *grp;
     int           ret;
 
+#ifdef __POSIX_PWGR_CACHE
+    ret = __pwgr_cache_lookup(&__group_cache, NULL, gid, buf, size);
+    if (ret >= 0) {
+        *grbufp = NULL;
+        if (ret == ENOENT)
+            return 0;
+        if (ret == 0 && (ret = __grent_parse(buf, buf, size, grbuf)) == 0)
+            *grbufp = grbuf;
+        return ret;
+    }
+#endif
     file = fopen(_PATH_GROUP, "r");
     if (!file)
         return errno;
@@ -54,7 +67,6 @@ getgrgid_r(gid_t gid, struct group *grbuf, char *buf, size_t size, struct group
         if (grp->gr_gid == gid)
             break;
     fclose(file);
-    if (ret == 0)
-        *grbufp = grp;
+    *grbufp = ret == 0 ? grp : NULL;
     return 0;
 }
@@ -39,6 +39,8 @@
 #include <grp.h>
 #include <string.h>
 #include <errno.h>
+#include "local-grp.h"
+#include "local-pwgr-cache.h"
 
 int
 getgrnam_r(const char *name, struct group *grbuf, char *buf, size_t size, struct group **grbufp)
@@ -47,6 +49,17 @@ getgrnam_r(const char *name, struct group *grbuf, char *buf, size_t size, struct
     struct group *grp;
     int           ret;
 
+#ifdef __POSIX_PWGR_CACHE
+    ret = __pwgr_cache_lookup(&__group_cache, name, 0, buf, size);
+    if (ret >= 0) {
+        *grbufp = NULL;
+        if (ret == ENOENT)
+            return 0;
+        if (ret == 0 && (ret = __grent_parse(buf, buf, size, grbuf)) == 0)
+            *grbufp = grbuf;
+        return ret;
+    }
+#endif
     file = fopen(_PATH_GROUP, "r");
     if (!file)
         return errno;
@@ -54,7 +67,6 @@ getgrnam_r(const char *name, struct group *grbuf, char *buf, size_t size, struct
         if (strcmp(name, grp->gr_name) == 0)
             break;
     fclose(file);
-    if (ret == 0)
-        *grbufp = grp;
+    *grbufp = ret == 0 ? grp : NULL;
     return 0;
 }
@@ -39,6 +39,8 @@
 #include <pwd.h>
 #include <string.h>
 #include <errno.h>
+#include "local-pwd.h"
+#include "local-pwgr-cache.h"
 
 int
 getpwuid_r(uid_t uid, struct passwd *pwbuf, char *buf, size_t size, struct passwd **pwbufp)
@@ -47,6 +49,17 @@ getpwuid_r(uid_t uid, struct passwd *pwbuf, char *buf, size_t size, struct passw
     struct passwd *pwd;
     int            ret;
 
+#ifdef __POSIX_PWGR_CACHE
+    ret = __pwgr_cache_lookup(&__passwd_cache, NULL, uid, buf, size);
+    if (ret >= 0) {
+        *pwbufp = NULL;
+        if (ret == ENOENT)
+            return 0;
+        if (ret == 0 && (ret = __pwent_parse(buf, pwbuf)) == 0)
+            *pwbufp = pwbuf;
+        return ret;
+    }
+#endif
     file = fopen(_PATH_PASSWD, "r");
     if (!file)
         return errno;
@@ -54,7 +67,6 @@ getpwuid_r(uid_t uid, struct passwd *pwbuf, char *buf, size_t size, struct passw
         if (pwd->pw_uid == uid)
             break;
     fclose(file);
-    if (ret == 0)
-        *pwbufp = pwd;
+    *pwbufp = ret == 0 ? pwd : NULL;
     return 0;
 }
@@ -42,4 +42,6 @@ extern char         __group_buffer[BUFSIZ];
 extern struct group __group_data;
 extern FILE        *__group_file;
 
+int __grent_parse(char *line, char *buf, size_t size, struct group *grbuf);
+
 #endif /* _LOCAL_GRP_H_ */
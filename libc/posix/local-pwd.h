@@ -42,4 +42,6 @@ extern char          __passwd_buffer[BUFSIZ];
 extern struct passwd __passwd_data;
 extern FILE         *__passwd_file;
 
+int __pwent_parse(char *line, struct passwd *pwbuf);
+
 #endif /* _LOCAL_PWD_H_ */
@@ -0,0 +1,84 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent <agent@local>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _LOCAL_PWGR_CACHE_H_
+#define _LOCAL_PWGR_CACHE_H_
+#include <sys/types.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+
+/*
+ * In-memory copy of /etc/passwd or /etc/group, indexed by the name
+ * (first) field and the numeric id (third) field of each line. Both
+ * file formats place those fields in the same position, so one
+ * implementation serves both.
+ */
+
+struct __pwgr_entry {
+    uint32_t offset; /* start of the line within data */
+    uint32_t length; /* length of the line, not including the newline */
+    uint32_t hash;   /* hash of the name field */
+    id_t     id;     /* value of the id field */
+};
+
+struct __pwgr_cache {
+    const char          *path;
+    char                *data;
+    struct __pwgr_entry *entries;
+    uint32_t            *by_name; /* entry index + 1, 0 for empty */
+    uint32_t            *by_id;
+    uint32_t             mask;
+    bool                 valid;
+    dev_t                dev;
+    ino_t                ino;
+    off_t                size;
+    struct timespec      mtim;
+};
+
+extern struct __pwgr_cache __passwd_cache;
+extern struct __pwgr_cache __group_cache;
+
+/*
+ * Look up an entry by name (or by id when name is NULL) and copy the
+ * matching line, NUL terminated, to the start of buf. Returns 0 on
+ * success, ENOENT when there is no matching entry, ERANGE when buf is
+ * too small and -1 when the cache is not available and the caller
+ * should scan the file instead.
+ */
+int __pwgr_cache_lookup(struct __pwgr_cache *cache, const char *name, id_t id, char *buf,
+                        size_t size);
+
+#endif /* _LOCAL_PWGR_CACHE_H_ */
@@ -0,0 +1,303 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent <agent@local>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define _DEFAULT_SOURCE
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/lock.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <pwd.h>
+#include <grp.h>
+#include "local-pwgr-cache.h"
+
+#ifdef __POSIX_PWGR_CACHE
+
+/*
+ * getpwnam_r and friends normally open the database and parse it
+ * line by line on every call. With the cache enabled, the whole file
+ * is read into memory once and indexed by name and id. Each lookup
+ * calls stat to check whether the file has been replaced or modified
+ * since it was loaded, so updates are visible on the next call.
+ */
+
+struct __pwgr_cache __passwd_cache = { .path = _PATH_PASSWD };
+struct __pwgr_cache __group_cache = { .path = _PATH_GROUP };
+
+#define FNV_OFFSET 2166136261U
+#define FNV_PRIME  16777619U
+
+static uint32_t
+name_hash(const char *name, size_t len)
+{
+    uint32_t hash = FNV_OFFSET;
+
+    while (len--) {
+        hash ^= (unsigned char)*name++;
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+static uint32_t
+id_hash(id_t id)
+{
+    return (uint32_t)id * 0x9e3779b1U;
+}
+
+static void
+cache_flush(struct __pwgr_cache *cache)
+{
+    free(cache->data);
+    free(cache->entries);
+    cache->data = NULL;
+    cache->entries = NULL;
+    cache->by_name = NULL;
+    cache->by_id = NULL;
+    cache->valid = false;
+}
+
+/*
+ * Insert entry e into the table, skipping it when an earlier entry
+ * already matches so that lookups return the first matching line, as
+ * a linear scan would.
+ */
+static void
+cache_insert(struct __pwgr_cache *cache, uint32_t *table, uint32_t e, bool by_name)
+{
+    struct __pwgr_entry *entry = &cache->entries[e];
+    uint32_t             h = by_name ? entry->hash : id_hash(entry->id);
+    uint32_t             slot;
+
+    for (slot = h & cache->mask; table[slot]; slot = (slot + 1) & cache->mask) {
+        struct __pwgr_entry *other = &cache->entries[table[slot] - 1];
+        if (by_name) {
+            size_t len = strcspn(cache->data + entry->offset, ":");
+            if (other->hash == entry->hash
+                && strncmp(cache->data + other->offset, cache->data + entry->offset, len + 1)
+                    == 0)
+                return;
+        } else if (other->id == entry->id) {
+            return;
+        }
+    }
+    table[slot] = e + 1;
+}
+
+/*
+ * Parse one line into an entry, returning false for lines which lack
+ * a name or a numeric id; those could never match a lookup.
+ */
+static bool
+cache_entry(char *line, size_t length, struct __pwgr_entry *entry)
+{
+    char         *end = line + length;
+    char         *colon;
+    char         *num_end;
+    unsigned long id;
+
+    colon = memchr(line, ':', length);
+    if (!colon || colon == line)
+        return false;
+    entry->hash = name_hash(line, colon - line);
+
+    /* Skip the password field */
+    line = colon + 1;
+    colon = memchr(line, ':', end - line);
+    if (!colon)
+        return false;
+
+    /* A group line may end right after the id */
+    line = colon + 1;
+    colon = memchr(line, ':', end - line);
+    if (!colon)
+        colon = end;
+    if (line == colon)
+        return false;
+    id = strtoul(line, &num_end, 10);
+    if (num_end != colon)
+        return false;
+    entry->id = (id_t)id;
+    return true;
+}
+
+static bool
+cache_load(struct __pwgr_cache *cache, const struct stat *st)
+{
+    FILE                *file;
+    char                *data;
+    struct __pwgr_entry *entries;
+    size_t               len, nline, n, e, tsize;
+    char                *line, *nl;
+    size_t               alloc;
+
+    if (st->st_size < 0 || (uintmax_t)st->st_size >= UINT32_MAX)
+        return false;
+
+    data = malloc((size_t)st->st_size + 1);
+    if (!data)
+        return false;
+    file = fopen(cache->path, "r");
+    if (!file) {
+        free(data);
+        return false;
+    }
+    len = fread(data, 1, (size_t)st->st_size, file);
+    fclose(file);
+    data[len] = '\0';
+
+    nline = 1;
+    for (line = data; (line = memchr(line, '\n', len - (line - data))) != NULL; line++)
+        nline++;
+
+    /* Keep the hash tables no more than half full */
+    for (tsize = 4; tsize < nline * 2; tsize <<= 1)
+        ;
+
+    alloc = nline * sizeof(struct __pwgr_entry) + 2 * tsize * sizeof(uint32_t);
+    entries = malloc(alloc);
+    if (!entries) {
+        free(data);
+        return false;
+    }
+
+    n = 0;
+    for (line = data; line < data + len; line = nl + 1) {
+        nl = memchr(line, '\n', len - (line - data));
+        if (!nl)
+            nl = data + len;
+        if (cache_entry(line, nl - line, &entries[n])) {
+            entries[n].offset = line - data;
+            entries[n].length = nl - line;
+            n++;
+        }
+    }
+
+    cache->data = data;
+    cache->entries = entries;
+    cache->by_name = (uint32_t *)(entries + nline);
+    cache->by_id = cache->by_name + tsize;
+    cache->mask = tsize - 1;
+    memset(cache->by_name, 0, 2 * tsize * sizeof(uint32_t));
+    for (e = 0; e < n; e++) {
+        cache_insert(cache, cache->by_name, e, true);
+        cache_insert(cache, cache->by_id, e, false);
+    }
+
+    cache->dev = st->st_dev;
+    cache->ino = st->st_ino;
+    cache->size = st->st_size;
+    cache->mtim = st->st_mtim;
+    cache->valid = true;
+    return true;
+}
+
+static bool
+cache_current(struct __pwgr_cache *cache, const struct stat *st)
+{
+    return cache->valid && cache->dev == st->st_dev && cache->ino == st->st_ino
+        && cache->size == st->st_size && cache->mtim.tv_sec == st->st_mtim.tv_sec
+        && cache->mtim.tv_nsec == st->st_mtim.tv_nsec;
+}
+
+static struct __pwgr_entry *
+cache_find(struct __pwgr_cache *cache, const char *name, id_t id)
+{
+    uint32_t *table = name ? cache->by_name : cache->by_id;
+    uint32_t  h;
+    size_t    len = 0;
+    uint32_t  slot;
+
+    if (name) {
+        len = strlen(name);
+        h = name_hash(name, len);
+    } else {
+        h = id_hash(id);
+    }
+    for (slot = h & cache->mask; table[slot]; slot = (slot + 1) & cache->mask) {
+        struct __pwgr_entry *entry = &cache->entries[table[slot] - 1];
+        const char          *line = cache->data + entry->offset;
+        if (name) {
+            if (entry->hash == h && strncmp(line, name, len) == 0 && line[len] == ':')
+                return entry;
+        } else if (entry->id == id) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+int
+__pwgr_cache_lookup(struct __pwgr_cache *cache, const char *name, id_t id, char *buf,
+                    size_t size)
+{
+    struct stat          st;
+    struct __pwgr_entry *entry;
+    int                  ret;
+
+    struct __pwgr_cache  old = { 0 };
+
+    if (stat(cache->path, &st) < 0)
+        return -1;
+
+    __LIBC_LOCK();
+    if (!cache_current(cache, &st)) {
+        struct __pwgr_cache fresh = { .path = cache->path };
+
+        /* Read the file without holding the lock across malloc and stdio */
+        __LIBC_UNLOCK();
+        if (!cache_load(&fresh, &st))
+            return -1;
+        __LIBC_LOCK();
+        old = *cache;
+        *cache = fresh;
+    }
+    if ((entry = cache_find(cache, name, id)) == NULL) {
+        ret = ENOENT;
+    } else if (entry->length >= size) {
+        ret = ERANGE;
+    } else {
+        memcpy(buf, cache->data + entry->offset, entry->length);
+        buf[entry->length] = '\0';
+        ret = 0;
+    }
+    __LIBC_UNLOCK();
+    cache_flush(&old);
+    return ret;
+}
+
+#endif /* __POSIX_PWGR_CACHE */
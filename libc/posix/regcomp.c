@@ -116,6 +116,7 @@ static int   altoffset(sop *scan, int offset, int mccs);
 static void  computejumps(struct parse *p, struct re_guts *g);
 static void  computematchjumps(struct parse *p, struct re_guts *g);
 static sopno pluscount(struct parse *p, struct re_guts *g);
+static void  dfasetup(struct parse *p, struct re_guts *g);
 #if used
 static void  mcadd(struct parse *p, cset *cs, char *cp);
 static void  mcsub(cset *cs, char *cp);
@@ -243,6 +244,7 @@ regcomp(regex_t * __restrict preg, const char * __restrict pattern, int cflags)
     g->categories = &g->catspace[-(CHAR_MIN)];
     (void)memset((char *)g->catspace, 0, NC * sizeof(cat_t));
     g->backrefs = 0;
+    g->dfa = NULL;
 
     /* do it */
     EMIT(OEND, 0);
@@ -272,6 +274,7 @@ regcomp(regex_t * __restrict preg, const char * __restrict pattern, int cflags)
         }
     }
     g->nplus = pluscount(p, g);
+    dfasetup(p, g);
     g->magic = MAGIC2;
     preg->re_nsub = g->nsub;
     preg->re_g = g;
@@ -1988,3 +1991,33 @@ pluscount(struct parse *p, struct re_guts *g)
         g->iflags |= BAD;
     return (maxnest);
 }
+
+/*
+ - dfasetup - decide whether regexec can use the cached DFA
+ == static void dfasetup(struct parse *p, struct re_guts *g);
+ *
+ * The DFA only covers the small state representation and has no
+ * notion of word boundaries; back references are left to the NFA code
+ * as well.  The tables themselves are built by regexec on first use.
+ */
+static void
+dfasetup(struct parse *p, struct re_guts *g)
+{
+    sop *scan;
+    sop  s;
+
+    if (p->error != 0 || g->backrefs || g->nstates > (sopno)(CHAR_BIT * sizeof(long)))
+        return;
+
+    scan = g->strip + 1;
+    do {
+        s = *scan++;
+        if (OP(s) == OBOW || OP(s) == OEOW || OP(s) == OBACK_)
+            return;
+    } while (OP(s) != OEND);
+
+    g->dfa = calloc(1, sizeof(struct re_dfa));
+    if (g->dfa == NULL)
+        return; /* not an error, just slower */
+    __lock_init(g->dfa->lock);
+}
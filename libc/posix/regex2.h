@@ -133,6 +133,36 @@ typedef struct {
 /* stuff for character categories */
 typedef unsigned char cat_t;
 
+#include <sys/lock.h>
+
+/*
+ * Lazily built DFA for the "fast" matcher.  Each DFA state stands for
+ * a set of strip states (in the small, single-word representation);
+ * transitions are computed with step() the first time they are taken
+ * and remembered afterwards.  Characters which no operator can tell
+ * apart share one column of the transition table.  When all DFA_NSTATES
+ * slots are in use, the whole cache is discarded and rebuilt on demand,
+ * or bypassed while another regexec is using it.
+ */
+#define DFA_NSTATES 64
+#define DFA_UNKNOWN 0xff /* transition not yet computed */
+#define DFA_ACCEPT  01   /* state includes the final state */
+#define DFA_FRESH   02   /* state is the fresh-start set */
+struct re_dfa {
+#ifndef __SINGLE_THREAD
+    _LOCK_T lock; /* held while adding states */
+#endif
+    int   users;            /* scans in progress */
+    int   nclasses;         /* number of character classes */
+    int   nstates;          /* DFA states in use */
+    long  fresh;            /* states for a fresh start */
+    uch  *classes;          /* -> uch[NC], class of each character */
+    uch  *reps;             /* -> uch[nclasses], a character in each class */
+    long *sets;             /* -> long[DFA_NSTATES], strip states */
+    uch  *flags;            /* -> uch[DFA_NSTATES] */
+    uch  *trans;            /* -> uch[DFA_NSTATES][nclasses] */
+};
+
 /*
  * main compiled-expression structure
  */
@@ -164,6 +194,7 @@ struct re_guts {
     size_t nsub;        /* copy of re_nsub */
     int    backrefs;    /* does it use back references? */
     sopno  nplus;       /* how deep does it nest +s? */
+    struct re_dfa *dfa; /* NULL if the DFA can't be used */
     /* catspace must be last */
     cat_t  catspace[NC]; /* categories */
 };
@@ -33,6 +33,7 @@
  *	@(#)regexec.c	8.3 (Berkeley) 3/20/94
  */
 
+#define _GNU_SOURCE
 #ifndef _NO_REGEX
 
 #if defined(LIBC_SCCS) && !defined(lint)
@@ -169,7 +170,7 @@ regexec(const regex_t * __restrict preg, const char * __restrict string, size_t
 #ifdef REDEBUG
 #define GOODFLAGS(f) (f)
 #else
-#define GOODFLAGS(f) ((f) & (REG_NOTBOL | REG_NOTEOL | REG_STARTEND))
+#define GOODFLAGS(f) ((f) & (REG_NOTBOL | REG_NOTEOL | REG_STARTEND | REG_LARGE))
 #endif
 
     if (preg->re_magic != MAGIC1 || g->magic != MAGIC2)
@@ -78,6 +78,11 @@ regfree(regex_t *preg)
         free(g->charjump);
     if (g->matchjump != NULL)
         free(g->matchjump);
+    if (g->dfa != NULL) {
+        __lock_close(g->dfa->lock);
+        free(g->dfa->sets);
+        free(g->dfa);
+    }
     free((char *)g);
 }
 
@@ -40,10 +40,10 @@ void
 __bufio_lock_init(FILE *f)
 {
     struct __file_bufio *bf = (struct __file_bufio *)f;
-    __LIBC_LOCK();
+    __SFP_LOCK();
     if (!bf->lock)
         __lock_init(bf->lock);
-    __LIBC_UNLOCK();
+    __SFP_UNLOCK();
 }
 #endif
 
@@ -75,7 +75,11 @@ __bufio_flush_locked(FILE *f)
         backup = bf->len - bf->off;
         if (backup) {
             bf->pos -= backup;
-            (void)bufio_lseek(bf, bf->pos, SEEK_SET);
+#ifdef __FAST_BUFIO
+            /* pread/pwrite will use the new position directly */
+            if (!(bf->bflags & __BSTALE))
+#endif
+                (void)bufio_lseek(bf, bf->pos, SEEK_SET);
         }
         bf->len = 0;
         bf->off = 0;
@@ -117,6 +121,12 @@ __bufio_flush(FILE *f)
 
     __bufio_lock(f);
     ret = __bufio_flush_locked(f);
+#ifdef __FAST_BUFIO
+    /* Leave the fd offset matching the stream for other users */
+    struct __file_bufio *bf = (struct __file_bufio *)f;
+    if ((bf->bflags & __BSTALE) && bufio_lseek(bf, bf->pos, SEEK_SET) >= 0)
+        bf->bflags &= ~__BSTALE;
+#endif
     __bufio_unlock(f);
     return ret;
 }
@@ -242,9 +252,30 @@ __bufio_seek(FILE *f, off_t offset, int whence)
         }
         __fallthrough;
     default:
+#ifdef __FAST_BUFIO
+        /*
+         * Once lseek has worked, absolute seeks only need to record
+         * the new position; reads and writes then use pread/pwrite
+         * at that position, saving a system call. Append-mode fds
+         * have no pwrite_int as pwrite would ignore the position
+         */
+        if (whence == SEEK_SET && offset >= 0 && (bf->bflags & __BSEEK) && bf->pread_int
+            && bf->pwrite_int) {
+            ret = offset;
+            bf->pos = offset;
+            bf->bflags |= __BSTALE;
+            bf->len = 0;
+            bf->off = 0;
+            break;
+        }
+#endif
         ret = bufio_lseek(bf, offset, whence);
-        if (ret >= 0)
+        if (ret >= 0) {
             bf->pos = ret;
+#ifdef __FAST_BUFIO
+            bf->bflags = (bf->bflags & ~__BSTALE) | __BSEEK;
+#endif
+        }
         /* Flush any buffered data after a real seek */
         bf->len = 0;
         bf->off = 0;
@@ -43,12 +43,12 @@ void
 _bufio_exit_flush(void)
 {
     for (;;) {
-        __LIBC_LOCK();
+        __SFP_LOCK();
         FILE                *f = __stdio_file_list;
         struct __file_bufio *bf = (struct __file_bufio *)f;
         if (bf)
             __stdio_file_list = bf->next;
-        __LIBC_UNLOCK();
+        __SFP_UNLOCK();
         if (!f)
             break;
         fflush(f);
@@ -0,0 +1,83 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent <agent@local>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "local-stdio.h"
+
+int
+__fconsume(FILE *stream, size_t n)
+{
+    int    ret = EOF;
+    size_t pending;
+
+    __flockfile(stream);
+    if ((stream->flags & __SRD) == 0)
+        goto bail;
+
+    /*
+     * A pending ungetc character is the first byte of the window. Make
+     * sure the rest of n is available before discarding it.
+     */
+    pending = __atomic_load_ungetc(&stream->unget) != 0;
+
+    if (n <= pending) {
+        ret = 0;
+    } else if (stream->flags & __SBUF) {
+        struct __file_bufio *bf = (struct __file_bufio *)stream;
+
+        __bufio_lock(stream);
+        if (bf->dir == __SRD && n - pending <= (size_t)(bf->len - bf->off)) {
+            bf->off += n - pending;
+            ret = 0;
+        }
+        __bufio_unlock(stream);
+    }
+#ifdef __FAST_MEMSTREAM
+    else if (__file_window(stream)) {
+        struct __file_ext *xf = __file_window(stream);
+        size_t             avail = n - pending;
+
+        if (xf->window(stream, __SRD, &avail) && n - pending <= avail) {
+            xf->advance(stream, __SRD, n - pending);
+            ret = 0;
+        }
+    }
+#endif
+    if (ret)
+        errno = EINVAL;
+    else if (n > 0 && pending)
+        (void)__atomic_exchange_ungetc(&stream->unget, 0);
+bail:
+    __funlock_return(stream, ret);
+}
@@ -60,6 +60,11 @@ fdopen(int fd, const char *mode)
 
     *bf = (struct __file_bufio)FDEV_SETUP_POSIX(fd, buf, buf_size, stdio_flags, __BFALL);
 
+#ifdef __FAST_BUFIO
+    if (bufio_fd_append(fd, open_flags))
+        bf->pwrite_int = NULL;
+#endif
+
     if (open_flags & O_APPEND)
         (void)fseeko(&(bf->xfile.cfile.file), 0, SEEK_END);
 
@@ -31,6 +31,11 @@
 
 #include "local-stdio.h"
 
+#ifdef __FAST_BUFIO
+extern FILE * const stdin __weak;
+extern FILE * const stdout __weak;
+#endif
+
 char *
 fgets(char *str, int size, FILE *stream)
 {
@@ -42,6 +47,114 @@ fgets(char *str, int size, FILE *stream)
         __funlock_return(stream, NULL);
 
     size--;
+
+#ifdef __FAST_BUFIO
+    if ((stream->flags & __SBUF) != 0) {
+        struct __file_bufio *bf = (struct __file_bufio *)stream;
+        __ungetc_t           unget;
+        bool                 flushed = false;
+        bool                 found = false;
+
+        cp = str;
+
+        /* Deal with any pending unget */
+        if (size > 0 && (unget = __atomic_exchange_ungetc(&stream->unget, 0)) != 0) {
+            *cp++ = (char)(unget - 1);
+            size--;
+            found = (unget - 1) == '\n';
+        }
+
+    again:
+        __bufio_lock(stream);
+        __bufio_setdir_locked(stream, __SRD);
+
+        while (!found && size > 0) {
+            int this_time = bf->len - bf->off;
+
+            if (this_time) {
+                /* Copy up to and including the newline */
+                char *src = bf->buf + bf->off;
+                char *end;
+
+                if (size < this_time)
+                    this_time = size;
+                end = memchr(src, '\n', this_time);
+                if (end) {
+                    this_time = end - src + 1;
+                    found = true;
+                }
+                memcpy(cp, src, this_time);
+                bf->off += this_time;
+                cp += this_time;
+                size -= this_time;
+            } else {
+                /* Flush stdout if reading from stdin */
+                if (!flushed) {
+                    flushed = true;
+                    if (&stdin != NULL && &stdout != NULL && stream == stdin) {
+                        __bufio_unlock(stream);
+                        fflush(stdout);
+                        goto again;
+                    }
+                }
+                int ret = __bufio_fill_locked(stream);
+                if (ret) {
+                    stream->flags |= (ret == _FDEV_ERR) ? __SERR : __SEOF;
+                    break;
+                }
+            }
+        }
+        __bufio_unlock(stream);
+        if (cp == str && size > 0)
+            __funlock_return(stream, NULL);
+        *cp = '\0';
+        __funlock_return(stream, str);
+    }
+#endif
+#ifdef __FAST_MEMSTREAM
+    if (__file_window(stream)) {
+        struct __file_ext *xf = __file_window(stream);
+        __ungetc_t         unget;
+        bool               found = false;
+
+        cp = str;
+
+        /* Deal with any pending unget */
+        if (size > 0 && (unget = __atomic_exchange_ungetc(&stream->unget, 0)) != 0) {
+            *cp++ = (char)(unget - 1);
+            size--;
+            found = (unget - 1) == '\n';
+        }
+
+        while (!found && size > 0) {
+            /* Copy up to and including the newline */
+            size_t avail = size;
+            char  *src = xf->window(stream, __SRD, &avail);
+            char  *end;
+
+            if (!src || !avail) {
+                stream->flags |= __SEOF;
+                break;
+            }
+            if (avail > (size_t)size)
+                avail = size;
+            end = memchr(src, '\n', avail);
+            if (end) {
+                avail = end - src + 1;
+                found = true;
+            }
+            memcpy(cp, src, avail);
+            xf->advance(stream, __SRD, avail);
+            cp += avail;
+            size -= avail;
+        }
+        if (cp == str && size > 0)
+            __funlock_return(stream, NULL);
+        *cp = '\0';
+        __funlock_return(stream, str);
+    }
+#endif
+
     for (c = 0, cp = str; c != '\n' && size > 0; size--, cp++) {
         if ((c = getc_unlocked(stream)) == EOF) {
             if (cp == str)
@@ -0,0 +1,122 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent <agent@local>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "local-stdio.h"
+
+#ifdef __FAST_MEMSTREAM
+
+size_t
+__file_window_read(FILE *f, void *buf, size_t len)
+{
+    struct __file_ext *xf = (struct __file_ext *)f;
+    char              *dst = buf;
+
+    while (len) {
+        size_t      avail = len;
+        const char *src = xf->window(f, __SRD, &avail);
+
+        if (!src || !avail) {
+            f->flags |= __SEOF;
+            break;
+        }
+        if (avail > len)
+            avail = len;
+        memcpy(dst, src, avail);
+        xf->advance(f, __SRD, avail);
+        dst += avail;
+        len -= avail;
+    }
+    return dst - (char *)buf;
+}
+
+size_t
+__file_window_write(FILE *f, const void *buf, size_t len)
+{
+    struct __file_ext *xf = (struct __file_ext *)f;
+    const char        *src = buf;
+
+    while (len) {
+        size_t avail = len;
+        char  *dst = xf->window(f, __SWR, &avail);
+
+        if (!dst || !avail)
+            break;
+        if (avail > len)
+            avail = len;
+        memcpy(dst, src, avail);
+        xf->advance(f, __SWR, avail);
+        src += avail;
+        len -= avail;
+    }
+    return src - (const char *)buf;
+}
+
+/*
+ * Called by printf when the current window is full. Commit what has
+ * been stored so far and open a new window, falling back to the put
+ * function when the stream has no more room.
+ */
+int
+__file_window_putc(char c, FILE *f, struct __file_window *w)
+{
+    struct __file_ext *xf = (struct __file_ext *)f;
+    size_t             avail = 1;
+    char              *dst;
+
+    __file_window_flush(f, w);
+    dst = xf->window(f, __SWR, &avail);
+    if (!dst || !avail) {
+        w->start = w->pos = w->end = NULL;
+        return f->put(c, f);
+    }
+    *dst = c;
+    w->start = dst;
+    w->pos = dst + 1;
+    w->end = dst + avail;
+    return (unsigned char)c;
+}
+
+void
+__file_window_flush(FILE *f, struct __file_window *w)
+{
+    struct __file_ext *xf = (struct __file_ext *)f;
+
+    if (w->pos != w->start) {
+        xf->advance(f, __SWR, w->pos - w->start);
+        w->start = w->pos;
+    }
+}
+
+#endif
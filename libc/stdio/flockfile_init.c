@@ -40,12 +40,12 @@ void
 __flockfile_init(FILE *f)
 {
     /*
-     * Use the global C library lock to ensure this
+     * Use the stdio global lock to ensure this
      * only initializes the lock once
      */
-    __LIBC_LOCK();
+    __SFP_LOCK();
     if (!f->lock)
         __lock_init_recursive(f->lock);
-    __LIBC_UNLOCK();
+    __SFP_UNLOCK();
 }
 #endif
@@ -86,6 +86,44 @@ __fmem_get(FILE *f)
     }
 }
 
+#ifdef __FAST_MEMSTREAM
+static char *
+__fmem_window(FILE *f, int dir, size_t *len)
+{
+    struct __file_mem *mf = (struct __file_mem *)f;
+    size_t             pos, end;
+
+    if (dir == __SWR) {
+        pos = mf->mflags & __MAPP ? mf->size : mf->pos;
+        end = mf->bufsize;
+    } else {
+        pos = mf->pos;
+        end = mf->size;
+    }
+    *len = pos < end ? end - pos : 0;
+    return mf->buf + pos;
+}
+
+static void
+__fmem_advance(FILE *f, int dir, size_t len)
+{
+    struct __file_mem *mf = (struct __file_mem *)f;
+
+    if (dir == __SWR) {
+        size_t pos = (mf->mflags & __MAPP ? mf->size : mf->pos) + len;
+        if (pos > mf->size) {
+            mf->size = pos;
+            /* Same null byte rule as __fmem_put */
+            if (mf->size < mf->bufsize)
+                mf->buf[mf->size] = '\0';
+        }
+        mf->pos = pos;
+    } else {
+        mf->pos += len;
+    }
+}
+#endif
+
 static int
 __fmem_flush(FILE *f)
 {
@@ -203,6 +241,10 @@ fmemopen(void *buf, size_t size, const char *mode)
         .pos = initial_pos,
         .mflags = mflags,
     };
+#ifdef __FAST_MEMSTREAM
+    mf->xfile.window = __fmem_window;
+    mf->xfile.advance = __fmem_advance;
+#endif
 
     return (FILE *)mf;
 }
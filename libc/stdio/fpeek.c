@@ -0,0 +1,138 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent <agent@local>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "local-stdio.h"
+
+extern FILE * const stdin __weak;
+extern FILE * const stdout __weak;
+
+/*
+ * A character pushed back with ungetc doesn't live in the stream
+ * buffer, so return it from this table as a one byte window. Streams
+ * with no buffer to look into are read a byte at a time the same way,
+ * using getc and ungetc.
+ */
+#define B1(n)  (n)
+#define B4(n)  B1(n), B1((n) + 1), B1((n) + 2), B1((n) + 3)
+#define B16(n) B4(n), B4((n) + 4), B4((n) + 8), B4((n) + 12)
+#define B64(n) B16(n), B16((n) + 16), B16((n) + 32), B16((n) + 48)
+
+static const unsigned char __fpeek_bytes[256] = { B64(0), B64(64), B64(128), B64(192) };
+
+const char *
+__fpeek(FILE *stream, size_t *len)
+{
+    struct __file_bufio *bf = (struct __file_bufio *)stream;
+    const char          *ret = NULL;
+    __ungetc_t           unget;
+    bool                 flushed = false;
+    int                  c;
+
+    *len = 0;
+    __flockfile(stream);
+    if ((stream->flags & __SRD) == 0)
+        __funlock_return(stream, NULL);
+
+    unget = __atomic_load_ungetc(&stream->unget);
+    if (unget != 0) {
+        /* When ungetc returned the previous byte, step back over it */
+        if (stream->flags & __SBUF) {
+            __bufio_lock(stream);
+            if (bf->dir == __SRD && bf->off > 0
+                && (unsigned char)bf->buf[bf->off - 1] == (unsigned char)(unget - 1)
+                && __atomic_compare_exchange_ungetc(&stream->unget, unget, 0)) {
+                bf->off--;
+                ret = bf->buf + bf->off;
+                *len = bf->len - bf->off;
+            }
+            __bufio_unlock(stream);
+        }
+        if (!ret) {
+            ret = (const char *)&__fpeek_bytes[(unsigned char)(unget - 1)];
+            *len = 1;
+        }
+        __funlock_return(stream, ret);
+    }
+
+#ifdef __FAST_MEMSTREAM
+    struct __file_ext *xf = __file_window(stream);
+
+    if (xf) {
+        ret = xf->window(stream, __SRD, len);
+        if (!ret || !*len) {
+            stream->flags |= __SEOF;
+            *len = 0;
+            ret = NULL;
+        }
+        __funlock_return(stream, ret);
+    }
+#endif
+
+    if ((stream->flags & __SBUF) == 0) {
+        c = getc(stream);
+        if (c == EOF || ungetc(c, stream) == EOF)
+            __funlock_return(stream, NULL);
+        *len = 1;
+        __funlock_return(stream, (const char *)&__fpeek_bytes[(unsigned char)c]);
+    }
+
+again:
+    __bufio_lock(stream);
+    if (__bufio_setdir_locked(stream, __SRD) < 0) {
+        stream->flags |= __SERR;
+        goto bail;
+    }
+    if (bf->off >= bf->len) {
+        /* Flush stdout if reading from stdin, as __bufio_get does */
+        if (!flushed) {
+            flushed = true;
+            if (&stdin != NULL && &stdout != NULL && stream == stdin) {
+                __bufio_unlock(stream);
+                fflush(stdout);
+                goto again;
+            }
+        }
+        int err = __bufio_fill_locked(stream);
+        if (err) {
+            stream->flags |= (err == _FDEV_ERR) ? __SERR : __SEOF;
+            goto bail;
+        }
+    }
+    ret = bf->buf + bf->off;
+    *len = bf->len - bf->off;
+bail:
+    __bufio_unlock(stream);
+    __funlock_return(stream, ret);
+}
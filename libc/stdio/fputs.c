@@ -42,6 +42,17 @@ fputs(const char *str, FILE *stream)
     if ((stream->flags & __SWR) == 0)
         goto fail;
 
+#ifdef __FAST_MEMSTREAM
+    if (__file_window(stream)) {
+        size_t len = strlen(str);
+        if (__file_window_write(stream, str, len) == len)
+            ret = 0;
+        else
+            stream->flags |= __SERR;
+        goto fail;
+    }
+#endif
+
     put = stream->put;
 
     while ((c = *str++) != '\0')
@@ -31,7 +31,7 @@
 
 #include "local-stdio.h"
 
-#ifdef __FAST_BUFIO
+#if defined(__FAST_BUFIO) || defined(__FAST_MEMSTREAM)
 #include "../stdlib/mul_overflow.h"
 #endif
 
@@ -114,6 +114,20 @@ fread(void *ptr, size_t size, size_t nmemb, FILE *stream)
         __bufio_unlock(stream);
         __funlock_return(stream, (cp - (uint8_t *)ptr) / size);
     }
+#endif
+#ifdef __FAST_MEMSTREAM
+    size_t total;
+    if (__file_window(stream) && !mul_overflow(size, nmemb, &total) && total > 0) {
+        __ungetc_t unget;
+
+        /* Deal with any pending unget */
+        if ((unget = __atomic_exchange_ungetc(&stream->unget, 0)) != 0) {
+            *cp++ = (unget - 1);
+            total--;
+        }
+        cp += __file_window_read(stream, cp, total);
+        __funlock_return(stream, (cp - (uint8_t *)ptr) / size);
+    }
 #endif
     for (i = 0; i < nmemb; i++)
         for (j = 0; j < size; j++) {
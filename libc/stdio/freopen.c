@@ -77,6 +77,12 @@ freopen(const char *pathname, const char *mode, FILE *stream)
     pf->write_int = write;
     pf->lseek_int = lseek;
     pf->close_int = close;
+#ifdef __FAST_BUFIO
+    pf->pread_int = __POSIX_PREAD;
+    pf->pwrite_int = bufio_fd_append(fd, open_flags) ? NULL : __POSIX_PWRITE;
+    pf->writev_int = writev;
+    pf->bflags &= ~(__BSTALE | __BSEEK);
+#endif
 
     /* Reset buffer mode and size */
     buf_size = bufio_get_buf_size(fd);
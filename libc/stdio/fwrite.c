@@ -31,9 +31,12 @@
 
 #include "local-stdio.h"
 
-#ifdef __FAST_BUFIO
+#if defined(__FAST_BUFIO) || defined(__FAST_MEMSTREAM)
 #include "../stdlib/mul_overflow.h"
 #endif
+#ifdef __FAST_BUFIO
+#include <sys/uio.h>
+#endif
 
 size_t
 fwrite(const void *ptr, size_t size, size_t nmemb, FILE *stream)
@@ -73,7 +76,31 @@ fwrite(const void *ptr, size_t size, size_t nmemb, FILE *stream)
                 bytes -= this_time;
             }
         } else {
-            /* Large writes go direct. */
+            /*
+             * Large writes go direct. Send any buffered bytes
+             * along with the new data in a single writev call
+             */
+            if (bf->len && bf->writev_int && !(bf->bflags & __BSTALE)) {
+                struct iovec iov[2] = {
+                    { .iov_base = bf->buf, .iov_len = bf->len },
+                    { .iov_base = (void *)cp, .iov_len = bytes },
+                };
+                ssize_t len = (bf->writev_int)(_FDEV_BUFIO_FD(bf), iov, 2);
+                if (len <= 0) {
+                    stream->flags |= _FDEV_ERR;
+                    goto done;
+                }
+                bf->pos += len;
+                if ((size_t)len >= (size_t)bf->len) {
+                    len -= bf->len;
+                    bf->len = 0;
+                    cp += len;
+                    bytes -= len;
+                } else {
+                    memmove(bf->buf, bf->buf + len, bf->len - len);
+                    bf->len -= len;
+                }
+            }
             if (__bufio_flush_locked(stream) >= 0) {
                 while (bytes) {
                     ssize_t len = bufio_write(bf, cp, bytes);
@@ -87,9 +114,15 @@ fwrite(const void *ptr, size_t size, size_t nmemb, FILE *stream)
                 }
             }
         }
+    done:
         __bufio_unlock(stream);
         __funlock_return(stream, (cp - (uint8_t *)ptr) / size);
     }
+#endif
+#ifdef __FAST_MEMSTREAM
+    size_t total;
+    if (__file_window(stream) && !mul_overflow(size, nmemb, &total))
+        __funlock_return(stream, __file_window_write(stream, cp, total) / size);
 #endif
     for (i = 0; i < nmemb; i++)
         for (j = 0; j < size; j++)
@@ -35,7 +35,46 @@
 
 #include "local-stdio.h"
 
-#define INCR 16
+#define MIN_SIZE 16
+
+#ifdef __FAST_BUFIO
+extern FILE * const stdin __weak;
+extern FILE * const stdout __weak;
+#endif
+
+/*
+ * Make sure the line buffer holds at least 'need' bytes. The
+ * allocation doubles each time so that reading a long line takes a
+ * logarithmic number of realloc calls. The caller's pointer and size
+ * are updated as soon as realloc succeeds so that they remain valid
+ * even if a later step fails.
+ */
+static char *
+getdelim_grow(char **lineptr, size_t *nptr, size_t n, size_t need)
+{
+    char *line;
+
+    if (need <= n)
+        return *lineptr;
+
+    /* Check for overflow of ssize_t */
+    if (need > SSIZE_MAX) {
+        errno = EOVERFLOW;
+        return NULL;
+    }
+
+    if (n < MIN_SIZE)
+        n = MIN_SIZE;
+    while (n < need)
+        n = n > SSIZE_MAX / 2 ? SSIZE_MAX : n * 2;
+
+    line = realloc(*lineptr, n);
+    if (line == NULL)
+        return NULL;
+    *lineptr = line;
+    *nptr = n;
+    return line;
+}
 
 ssize_t
 getdelim(char ** restrict lineptr, size_t * restrict nptr, int delim, FILE * restrict stream)
@@ -45,34 +84,156 @@ getdelim(char ** restrict lineptr, size_t * restrict nptr, int delim, FILE * res
     ssize_t count = 0;
 
     __flockfile(stream);
-    for (;;) {
-        int c = getc_unlocked(stream);
-        int is_eof = (c == EOF);
+
+#ifdef __FAST_BUFIO
+    if ((stream->flags & (__SRD | __SBUF)) == (__SRD | __SBUF)) {
+        struct __file_bufio *bf = (struct __file_bufio *)stream;
+        __ungetc_t           unget;
+        bool                 flushed = false;
+        bool                 found = false;
+
+        /* Deal with any pending unget */
+        if ((unget = __atomic_exchange_ungetc(&stream->unget, 0)) != 0) {
+            line = getdelim_grow(lineptr, nptr, n, 2);
+            if (line == NULL) {
+                count = -1;
+                goto bail;
+            }
+            n = *nptr;
+            line[count++] = (char)(unget - 1);
+            found = (unget - 1) == delim;
+        }
+
+    again:
+        __bufio_lock(stream);
+        __bufio_setdir_locked(stream, __SRD);
+
+        while (!found) {
+            size_t avail = bf->len - bf->off;
+
+            if (avail) {
+                /* Copy everything up to and including the delimiter */
+                char  *src = bf->buf + bf->off;
+                char  *end = NULL;
+                size_t span = avail;
+
+                /* Values outside of unsigned char never match */
+                if (delim == (unsigned char)delim)
+                    end = memchr(src, delim, avail);
+                if (end) {
+                    span = end - src + 1;
+                    found = true;
+                }
+                line = getdelim_grow(lineptr, nptr, n, (size_t)count + span + 1);
+                if (line == NULL) {
+                    __bufio_unlock(stream);
+                    count = -1;
+                    goto bail;
+                }
+                n = *nptr;
+                memcpy(line + count, src, span);
+                bf->off += span;
+                count += span;
+            } else {
+                /* Flush stdout if reading from stdin */
+                if (!flushed) {
+                    flushed = true;
+                    if (&stdin != NULL && &stdout != NULL && stream == stdin) {
+                        __bufio_unlock(stream);
+                        fflush(stdout);
+                        goto again;
+                    }
+                }
+                int ret = __bufio_fill_locked(stream);
+                if (ret) {
+                    stream->flags |= (ret == _FDEV_ERR) ? __SERR : __SEOF;
+                    break;
+                }
+            }
+        }
+        __bufio_unlock(stream);
 
         /* EOF at the start: return -1 */
-        if (is_eof && count == 0) {
+        if (count == 0) {
             count = -1;
             goto bail;
         }
+        goto done;
+    }
+#endif
+#ifdef __FAST_MEMSTREAM
+    if ((stream->flags & __SRD) && __file_window(stream)) {
+        struct __file_ext *xf = __file_window(stream);
+        __ungetc_t         unget;
+        bool               found = false;
 
-        /* Make space for char (if not eof) and '\0' terminator */
-        if ((size_t)count + !is_eof >= n) {
-
-            /* Check for overflow of ssize_t */
-            if (n > SSIZE_MAX - INCR) {
-                errno = EOVERFLOW;
+        /* Deal with any pending unget */
+        if ((unget = __atomic_exchange_ungetc(&stream->unget, 0)) != 0) {
+            line = getdelim_grow(lineptr, nptr, n, 2);
+            if (line == NULL) {
                 count = -1;
                 goto bail;
             }
-            n += INCR;
+            n = *nptr;
+            line[count++] = (char)(unget - 1);
+            found = (unget - 1) == delim;
+        }
 
-            line = realloc(line, n);
+        while (!found) {
+            /* Copy everything up to and including the delimiter */
+            size_t avail = SIZE_MAX;
+            char  *src = xf->window(stream, __SRD, &avail);
+            char  *end = NULL;
+
+            if (!src || !avail) {
+                stream->flags |= __SEOF;
+                break;
+            }
+            /* Values outside of unsigned char never match */
+            if (delim == (unsigned char)delim)
+                end = memchr(src, delim, avail);
+            if (end) {
+                avail = end - src + 1;
+                found = true;
+            }
+            line = getdelim_grow(lineptr, nptr, n, (size_t)count + avail + 1);
             if (line == NULL) {
                 count = -1;
                 goto bail;
             }
+            n = *nptr;
+            memcpy(line + count, src, avail);
+            xf->advance(stream, __SRD, avail);
+            count += avail;
+        }
+
+        /* EOF at the start: return -1 */
+        if (count == 0) {
+            count = -1;
+            goto bail;
+        }
+        goto done;
+    }
+#endif
+
+    for (;;) {
+        int c = getc_unlocked(stream);
+        int is_eof = (c == EOF);
+
+        /* EOF at the start: return -1 */
+        if (is_eof && count == 0) {
+            count = -1;
+            goto bail;
         }
 
+        /* Make space for char (if not eof) and '\0' terminator */
+        line = getdelim_grow(lineptr, nptr, n, (size_t)count + !is_eof + 1);
+        if (line == NULL) {
+            count = -1;
+            goto bail;
+        }
+        n = *nptr;
+
         if (is_eof)
             break;
 
@@ -80,10 +241,11 @@ getdelim(char ** restrict lineptr, size_t * restrict nptr, int delim, FILE * res
         if (c == delim)
             break;
     }
+#if defined(__FAST_BUFIO) || defined(__FAST_MEMSTREAM)
+done:
+#endif
     line[count] = '\0';
 
-    *lineptr = line;
-    *nptr = n;
 bail:
     __funlock_return(stream, count);
 }
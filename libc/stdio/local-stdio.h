@@ -164,6 +164,10 @@ struct __file_pipe {
 static inline ssize_t
 bufio_read(struct __file_bufio *bf, void *buf, size_t count)
 {
+#ifdef __FAST_BUFIO
+    if (bf->bflags & __BSTALE)
+        return (bf->pread_int)(_FDEV_BUFIO_FD(bf), buf, count, bf->pos);
+#endif
 #ifndef BUFIO_ABI_MATCHES
     if (!(bf->bflags & __BFPTR))
         return (bf->read_int)(_FDEV_BUFIO_FD(bf), buf, count);
@@ -174,6 +178,10 @@ bufio_read(struct __file_bufio *bf, void *buf, size_t count)
 static inline ssize_t
 bufio_write(struct __file_bufio *bf, const void *buf, size_t count)
 {
+#ifdef __FAST_BUFIO
+    if (bf->bflags & __BSTALE)
+        return (bf->pwrite_int)(_FDEV_BUFIO_FD(bf), buf, count, bf->pos);
+#endif
 #ifndef BUFIO_ABI_MATCHES
     if (!(bf->bflags & __BFPTR))
         return (bf->write_int)(_FDEV_BUFIO_FD(bf), buf, count);
@@ -238,6 +246,26 @@ bufio_get_buf_size(int fd)
 #define bufio_get_buf_size(fd) (BUFSIZ)
 #endif
 
+#ifdef __FAST_BUFIO
+/*
+ * pwrite ignores the offset on O_APPEND fds, so seeks on those
+ * streams must move the fd offset instead of using pread/pwrite.
+ */
+static inline bool
+bufio_fd_append(int fd, int open_flags)
+{
+    if (open_flags & O_APPEND)
+        return true;
+#ifdef __HAVE_FCNTL
+    int fl = fcntl(fd, F_GETFL);
+    return fl >= 0 && (fl & O_APPEND) != 0;
+#else
+    (void)fd;
+    return false;
+#endif
+}
+#endif
+
 #ifdef __STDIO_EXIT_FLUSH
 extern FILE *__stdio_file_list;
 
@@ -246,10 +274,10 @@ bufio_add_file(FILE *f)
 {
     struct __file_bufio *bf = (struct __file_bufio *)f;
 
-    __LIBC_LOCK();
+    __SFP_LOCK();
     bf->next = __stdio_file_list;
     __stdio_file_list = &(bf->xfile.cfile.file);
-    __LIBC_UNLOCK();
+    __SFP_UNLOCK();
 }
 
 static inline void
@@ -258,14 +286,14 @@ bufio_remove_file(FILE *f)
     FILE               **prev;
     struct __file_bufio *bf;
 
-    __LIBC_LOCK();
+    __SFP_LOCK();
     for (prev = &__stdio_file_list; (bf = (struct __file_bufio *)*prev); prev = &bf->next) {
         if (&(bf->xfile.cfile.file) == f) {
             *prev = bf->next;
             break;
         }
     }
-    __LIBC_UNLOCK();
+    __SFP_UNLOCK();
 }
 #else
 #define bufio_add_file(f)
@@ -274,6 +302,38 @@ bufio_remove_file(FILE *f)
 
 int  __stdio_flags(const char *mode, int *optr);
 
+#ifdef __FAST_MEMSTREAM
+/*
+ * Memory streams expose their backing store through the window and
+ * advance hooks. window returns a pointer to the current position for
+ * reading (__SRD) or writing (__SWR) and sets *len to the number of
+ * bytes available there; on entry, *len holds the number of bytes the
+ * caller would like so that growable streams can make room. advance
+ * then moves the position past the bytes actually transferred.
+ */
+static inline struct __file_ext *
+__file_window(FILE *f)
+{
+    struct __file_ext *xf = (struct __file_ext *)f;
+
+    if ((f->flags & __SEXT) && xf->window)
+        return xf;
+    return NULL;
+}
+
+/* An open output window, used by printf to store characters inline */
+struct __file_window {
+    char *start;
+    char *pos;
+    char *end;
+};
+
+size_t __file_window_read(FILE *f, void *buf, size_t len);
+size_t __file_window_write(FILE *f, const void *buf, size_t len);
+int    __file_window_putc(char c, FILE *f, struct __file_window *w);
+void   __file_window_flush(FILE *f, struct __file_window *w);
+#endif
+
 void _bufio_exit_flush(void) __weak;
 
 #ifdef __STDIO_LOCKING
@@ -45,8 +45,8 @@ __open_mem_grow(struct __file_open_mem *mf, size_t additional_size)
     if (required_size < bsize)
         return 0;
 
-    /* Avoid geometric growth, increase the buffer size by 1.5x */
-    bsize += bsize / 2;
+    /* Double the buffer so that appending is amortized constant time */
+    bsize += bsize;
 
     /* seek can move position beyond calculated size */
     if (bsize < required_size)
@@ -96,6 +96,34 @@ __open_mem_put(char c, FILE *f)
     return (unsigned char)c;
 }
 
+#ifdef __FAST_MEMSTREAM
+static char *
+__open_mem_window(FILE *f, int dir, size_t *len)
+{
+    struct __file_open_mem *mf = (struct __file_open_mem *)f;
+
+    if (dir != __SWR)
+        return NULL;
+
+    /* Make room for the requested data plus the null terminator */
+    if (*len == SIZE_MAX || __open_mem_grow(mf, *len + 1) != 0)
+        return NULL;
+
+    *len = mf->bsize - mf->pos - 1;
+    return GET_BUF(mf) + mf->pos;
+}
+
+static void
+__open_mem_advance(FILE *f, int dir, size_t len)
+{
+    struct __file_open_mem *mf = (struct __file_open_mem *)f;
+
+    (void)dir;
+    mf->pos += len;
+    mf->fsize = mf->pos;
+}
+#endif
+
 static int
 __open_mem_flush(FILE *f)
 {
@@ -179,6 +207,10 @@ open_memstream(char **buf, size_t *size)
         .fsize = 0,
         .pos = 0,
     };
+#ifdef __FAST_MEMSTREAM
+    mf->xfile.window = __open_mem_window;
+    mf->xfile.advance = __open_mem_advance;
+#endif
 
     return (FILE *)mf;
 }
@@ -130,6 +130,48 @@ udivmod(ultoa_unsigned_t val, int base, char *dig)
 #endif
 #endif
 
+#ifdef __IO_DIGIT_PAIRS
+
+#include "ryu/digit_table.h"
+
+/*
+ * Generate decimal digits two at a time using the table of digit
+ * pairs, which halves the number of divisions. When the value is
+ * wider than a long and we're avoiding soft division, strip digits
+ * off with udivmod10 until the rest fits.
+ */
+static inline char *
+__ultoa_invert_pairs(ultoa_unsigned_t val, char *str)
+{
+#ifdef FANCY_DIVMOD
+    while (val > ULONG_MAX) {
+        char v;
+        val = udivmod10(val, &v);
+        *str++ = v + '0';
+    }
+    unsigned long nval = (unsigned long)val;
+#else
+    ultoa_unsigned_t nval = val;
+#endif
+    unsigned r;
+
+    while (nval >= 100) {
+        r = (unsigned)(nval % 100) * 2;
+        nval /= 100;
+        *str++ = DIGIT_TABLE[r + 1];
+        *str++ = DIGIT_TABLE[r];
+    }
+    if (nval >= 10) {
+        r = (unsigned)nval * 2;
+        *str++ = DIGIT_TABLE[r + 1];
+        *str++ = DIGIT_TABLE[r];
+    } else {
+        *str++ = (char)nval + '0';
+    }
+    return str;
+}
+#endif
+
 static __noinline char *
 __ultoa_invert(ultoa_unsigned_t val, char *str, int base)
 {
@@ -137,6 +179,11 @@ __ultoa_invert(ultoa_unsigned_t val, char *str, int base)
 
     base &= 31;
 
+#ifdef __IO_DIGIT_PAIRS
+    if (base == 10)
+        return __ultoa_invert_pairs(val, str);
+#endif
+
     do {
         char v;
 
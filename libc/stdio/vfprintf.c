@@ -156,6 +156,11 @@
 
 #endif
 
+/* Shortest round-trip output relies on the exact (ryu) conversion code */
+#if IO_VARIANT_IS_FLOAT(PRINTF_VARIANT) && defined(__IO_FLOAT_EXACT)
+#define _NEED_IO_SHORTEST
+#endif
+
 /* Figure out which multi-byte char support we need */
 #if defined(_NEED_IO_WCHAR) && defined(__MB_CAPABLE)
 #ifdef WIDE_CHARS
@@ -266,21 +271,22 @@ typedef long          ultoa_signed_t;
 #define FL_LPAD  0x0008
 #endif /* else _NEED_IO_SHRINK */
 #define FL_ALT       0x0010
+#define FL_SHORTEST  0x0020
 
-#define FL_WIDTH     0x0020
-#define FL_PREC      0x0040
+#define FL_WIDTH     0x0040
+#define FL_PREC      0x0080
 
-#define FL_LONG      0x0080
-#define FL_SHORT     0x0100
-#define FL_REPD_TYPE 0x0200
+#define FL_LONG      0x0100
+#define FL_SHORT     0x0200
+#define FL_REPD_TYPE 0x0400
 
-#define FL_NEGATIVE  0x0400
+#define FL_NEGATIVE  0x0800
 
 #ifdef _NEED_IO_C99_FORMATS
-#define FL_FLTHEX 0x0800
+#define FL_FLTHEX 0x1000
 #endif
-#define FL_FLTEXP 0x1000
-#define FL_FLTFIX 0x2000
+#define FL_FLTEXP 0x2000
+#define FL_FLTFIX 0x4000
 
 #ifdef _NEED_IO_C99_FORMATS
 
@@ -383,6 +389,10 @@ skip_to_arg(const CHAR *fmt_orig, my_va_list *ap, int target_argno)
                     continue;
                 case '#':
                     continue;
+#ifdef _NEED_IO_SHORTEST
+                case '=':
+                    continue;
+#endif
                 case '\'':
                     continue;
                 }
@@ -408,8 +418,11 @@ skip_to_arg(const CHAR *fmt_orig, my_va_list *ap, int target_argno)
                             argno = width;
                             break;
                         }
-                    } else
+                    } else {
+                        /* Flags may follow the position */
                         argno = width;
+                        flags = 0;
+                    }
                     width = 0;
                     continue;
                 }
@@ -601,6 +614,22 @@ vfprintf(FILE *stream, const CHAR *fmt, va_list ap_orig)
         if (putwc(c, stream) == WEOF) \
             goto fail;                \
     } while (0)
+#elif defined(__FAST_MEMSTREAM)
+    /*
+     * Memory streams are written through a window directly into the
+     * backing store; put is cleared to select that path.
+     */
+    int (*put)(char, FILE *) = stream->put;
+    struct __file_window win = { 0 };
+#define PRINTF_WINDOW
+#define my_putc(c, stream)                                                          \
+    do {                                                                            \
+        ++stream_len;                                                               \
+        if (win.pos != win.end)                                                     \
+            *win.pos++ = (c);                                                       \
+        else if ((put ? put(c, stream) : __file_window_putc(c, stream, &win)) < 0) \
+            goto fail;                                                              \
+    } while (0)
 #else
     int (*put)(char, FILE *) = stream->put;
 #define my_putc(c, stream)      \
@@ -617,6 +646,11 @@ vfprintf(FILE *stream, const CHAR *fmt, va_list ap_orig)
     if ((stream->flags & __SWR) == 0)
         __funlock_return(stream, EOF);
 
+#ifdef PRINTF_WINDOW
+    if (__file_window(stream))
+        put = NULL;
+#endif
+
 #ifdef _NEED_IO_POS_ARGS
     va_copy(ap, ap_orig);
 #endif
@@ -662,6 +696,11 @@ vfprintf(FILE *stream, const CHAR *fmt, va_list ap_orig)
                 case '#':
                     flags |= FL_ALT;
                     continue;
+#ifdef _NEED_IO_SHORTEST
+                case '=':
+                    flags |= FL_SHORTEST;
+                    continue;
+#endif
                 case '\'':
                     /*
                      * C/POSIX locale has an empty thousands_sep
@@ -832,6 +871,10 @@ vfprintf(FILE *stream, const CHAR *fmt, va_list ap_orig)
 ret:
 #ifdef _NEED_IO_POS_ARGS
     va_end(ap);
+#endif
+#ifdef PRINTF_WINDOW
+    if (!put)
+        __file_window_flush(stream, &win);
 #endif
     __funlock_return(stream, stream_len);
 #undef my_putc
@@ -842,11 +885,16 @@ fail:
     goto ret;
 #ifdef VFPRINTF_S
 handle_error:
+#ifdef PRINTF_WINDOW
+    if (!put)
+        __file_window_flush(stream, &win);
+#endif
     if (__cur_handler != 0)
         __cur_handler(msg, NULL, -1);
     stream->flags |= __SERR;
     __funlock_return(stream, -1);
 #endif
+#undef PRINTF_WINDOW
 }
 
 #if !defined(VFPRINTF_S) && !defined(WIDE_CHARS)
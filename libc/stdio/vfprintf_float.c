@@ -84,6 +84,18 @@
             if (ndigs > LONG_FLOAT_MAX_DIG)
                 ndigs = LONG_FLOAT_MAX_DIG;
 
+#ifdef _NEED_IO_SHORTEST
+            if (flags & FL_SHORTEST) {
+#ifdef _NEED_IO_FLOAT_LARGE
+                /* The long double engine doesn't use ryu */
+                flags &= ~FL_SHORTEST;
+#else
+                ndigs = LONG_FLOAT_MAX_DIG;
+                fmode = false;
+#endif
+            }
+#endif
+
             ndigs = __lfloat_d_engine(fval, &u.dtoa, ndigs, fmode, ndecimal);
 
             ndigs_exp = 2;
@@ -135,11 +147,41 @@
             if (ndigs > FLOAT_MAX_DIG)
                 ndigs = FLOAT_MAX_DIG;
 
+#ifdef _NEED_IO_SHORTEST
+            /* Ask for as many digits as the engine can produce; ryu
+             * stops at the shortest string which reads back exactly */
+            if (flags & FL_SHORTEST) {
+                ndigs = FLOAT_MAX_DIG;
+                fmode = false;
+            }
+#endif
+
             ndigs = __float_d_engine(fval, &u.dtoa, ndigs, fmode, ndecimal);
             ndigs_exp = 2;
         }
     }
 
+#ifdef _NEED_IO_SHORTEST
+    /*
+     * Replace the precision with the smallest one which shows all
+     * of the shortest round-trip digits. For 'g', integers which fit
+     * in the type's precision are still shown without an exponent
+     */
+    if ((flags & FL_SHORTEST) && c != 'p') {
+        if (flags & FL_FLTFIX) {
+            prec = ndigs - u.dtoa.exp - 1;
+            if (prec < 0)
+                prec = 0;
+        } else if (flags & FL_FLTEXP) {
+            prec = ndigs - 1;
+        } else {
+            prec = ndigs;
+            if (prec <= u.dtoa.exp && u.dtoa.exp < FLOAT_MAX_DIG)
+                prec = u.dtoa.exp + 1;
+        }
+    }
+#endif
+
     sign = 0;
     if (u.dtoa.flags & DTOA_MINUS)
         sign = '-';
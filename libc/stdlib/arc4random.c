@@ -72,15 +72,116 @@ struct _rsx {
     unsigned char rs_buf[RSBUFSZ]; /* keystream blocks */
 };
 
-static bool        arc4random_init;
-static struct _rs  arc4random_rs;
-static struct _rsx arc4random_rsx;
+/*
+ * With per-thread state, each thread seeds its own generator the first
+ * time it asks for data and no locking is needed. Otherwise a single
+ * generator is shared under the arc4random lock.
+ */
+#if defined(__ARC4RANDOM_TLS) && defined(__THREAD_LOCAL_STORAGE)
+#define ARC4RANDOM_STATE __THREAD_LOCAL
+#define ARC4RANDOM_LOCK()
+#define ARC4RANDOM_UNLOCK()
+#else
+#define ARC4RANDOM_STATE
+#define ARC4RANDOM_LOCK()   __ARC4RANDOM_LOCK()
+#define ARC4RANDOM_UNLOCK() __ARC4RANDOM_UNLOCK()
+#endif
+
+static ARC4RANDOM_STATE bool        arc4random_init;
+static ARC4RANDOM_STATE struct _rs  arc4random_rs;
+static ARC4RANDOM_STATE struct _rsx arc4random_rsx;
 
 static inline void _rs_rekey(unsigned char *dat, size_t datlen);
 
 int                arc4random_fork_detect(void) __weak;
 void               arc4random_abort(void) __weak;
 
+#if !defined(__PREFER_SIZE_OVER_SPEED) && !defined(__OPTIMIZE_SIZE__) \
+    && (defined(__SSE2__) || defined(__ARM_NEON))
+
+/*
+ * Generate several blocks at once, one block per vector lane. The
+ * compiler maps these generic vectors to SSE2, AVX2 or NEON registers.
+ */
+#ifdef __AVX2__
+#define CHACHA_LANES      8
+#define CHACHA_LANE_INDEX { 0, 1, 2, 3, 4, 5, 6, 7 }
+#else
+#define CHACHA_LANES      4
+#define CHACHA_LANE_INDEX { 0, 1, 2, 3 }
+#endif
+
+typedef u32 chacha_vec __attribute__((vector_size(CHACHA_LANES * sizeof(u32))));
+
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define VSTORE32(p, v) memcpy((p), &(u32){ (v) }, 4)
+#else
+#define VSTORE32(p, v) U32TO8_LITTLE(p, v)
+#endif
+
+#define VROTATE(v, c) (((v) << (c)) | ((v) >> (32 - (c))))
+
+#define VQUARTERROUND(a, b, c, d) \
+    a += b;                       \
+    d = VROTATE(d ^ a, 16);       \
+    c += d;                       \
+    b = VROTATE(b ^ c, 12);       \
+    a += b;                       \
+    d = VROTATE(d ^ a, 8);        \
+    c += d;                       \
+    b = VROTATE(b ^ c, 7);
+
+static void
+chacha_keystream(chacha_ctx *x, u8 *c, size_t bytes)
+{
+    while (bytes >= CHACHA_LANES * BLOCKSZ) {
+        const chacha_vec lane = CHACHA_LANE_INDEX;
+        chacha_vec       j[16], v[16];
+        uint64_t         counter = ((uint64_t)x->input[13] << 32) | x->input[12];
+        int              i, b;
+
+        for (i = 0; i < 16; i++)
+            j[i] = (chacha_vec){ 0 } + x->input[i];
+
+        /* Each lane gets the next block counter, carrying into word 13 */
+        j[12] += lane;
+        j[13] -= (chacha_vec)(j[12] < lane);
+
+        for (i = 0; i < 16; i++)
+            v[i] = j[i];
+
+        for (i = 20; i > 0; i -= 2) {
+            VQUARTERROUND(v[0], v[4], v[8], v[12])
+            VQUARTERROUND(v[1], v[5], v[9], v[13])
+            VQUARTERROUND(v[2], v[6], v[10], v[14])
+            VQUARTERROUND(v[3], v[7], v[11], v[15])
+            VQUARTERROUND(v[0], v[5], v[10], v[15])
+            VQUARTERROUND(v[1], v[6], v[11], v[12])
+            VQUARTERROUND(v[2], v[7], v[8], v[13])
+            VQUARTERROUND(v[3], v[4], v[9], v[14])
+        }
+
+        for (i = 0; i < 16; i++)
+            v[i] += j[i];
+        for (b = 0; b < CHACHA_LANES; b++)
+            for (i = 0; i < 16; i++)
+                VSTORE32(c + b * BLOCKSZ + i * 4, v[i][b]);
+
+        counter += CHACHA_LANES;
+        x->input[12] = (u32)counter;
+        x->input[13] = (u32)(counter >> 32);
+        c += CHACHA_LANES * BLOCKSZ;
+        bytes -= CHACHA_LANES * BLOCKSZ;
+    }
+    chacha_encrypt_bytes(x, c, c, bytes);
+}
+
+#else
+
+#define chacha_keystream(x, c, bytes) chacha_encrypt_bytes(x, c, c, bytes)
+
+#endif
+
 static inline void
 _rs_init(unsigned char *buf, size_t n)
 {
@@ -140,8 +241,7 @@ _rs_rekey(unsigned char *dat, size_t datlen)
     memset(arc4random_rsx.rs_buf, 0, sizeof(arc4random_rsx.rs_buf));
 #endif
     /* fill rs_buf with the keystream */
-    chacha_encrypt_bytes(&arc4random_rsx.rs_chacha, arc4random_rsx.rs_buf, arc4random_rsx.rs_buf,
-                         sizeof(arc4random_rsx.rs_buf));
+    chacha_keystream(&arc4random_rsx.rs_chacha, arc4random_rsx.rs_buf, sizeof(arc4random_rsx.rs_buf));
     /* mix in optional user provided data */
     if (dat) {
         size_t i, m;
@@ -199,16 +299,16 @@ arc4random(void)
 {
     uint32_t val;
 
-    __LIBC_LOCK();
+    ARC4RANDOM_LOCK();
     _rs_random_u32(&val);
-    __LIBC_UNLOCK();
+    ARC4RANDOM_UNLOCK();
     return val;
 }
 
 void
 arc4random_buf(void *buf, size_t n)
 {
-    __LIBC_LOCK();
+    ARC4RANDOM_LOCK();
     _rs_random_buf(buf, n);
-    __LIBC_UNLOCK();
+    ARC4RANDOM_UNLOCK();
 }
@@ -35,17 +35,26 @@
 
 #define _DEFAULT_SOURCE
 #include <stdlib.h>
-#include <string.h>
 #include <sys/lock.h>
 #include <limits.h>
 #include "local-onexit.h"
 
 #ifdef ENABLE_PICOLIBC_EXIT
 
+#if defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_4) && !defined(__SINGLE_THREAD)
+#define ONEXIT_ATOMIC
+#include <stdatomic.h>
+typedef _Atomic unsigned on_exit_index_t;
+typedef _Atomic unsigned on_exit_kind_t;
+#else
+typedef unsigned on_exit_index_t;
+typedef unsigned on_exit_kind_t;
+#endif
+
 struct on_exit {
-    union on_exit_func    func;
-    void                 *arg;
-    enum pico_onexit_kind kind;
+    union on_exit_func func;
+    void              *arg;
+    on_exit_kind_t     kind;
 };
 
 /*
@@ -59,25 +68,89 @@ struct on_exit {
 #define __ATEXIT_COUNT ATEXIT_MAX
 #endif
 
-static struct on_exit on_exits[__ATEXIT_COUNT];
+/*
+ * Handlers are stored in registration order. Registering reserves the
+ * next slot by advancing on_exit_count, fills it in and then publishes
+ * it by setting the kind; running them walks back down from the top,
+ * claiming each slot by clearing its kind.
+ */
+static struct on_exit  on_exits[__ATEXIT_COUNT];
+static on_exit_index_t on_exit_count;
+
+#ifdef ONEXIT_ATOMIC
+
+static int
+on_exit_reserve(void)
+{
+    unsigned o = atomic_load_explicit(&on_exit_count, memory_order_relaxed);
+
+    do {
+        if (o >= __ATEXIT_COUNT)
+            return -1;
+    } while (!atomic_compare_exchange_weak_explicit(&on_exit_count, &o, o + 1,
+                                                    memory_order_relaxed, memory_order_relaxed));
+    return (int)o;
+}
+
+#define on_exit_publish(o, k) atomic_store_explicit(&(o)->kind, k, memory_order_release)
+#define on_exit_claim(o)      atomic_exchange_explicit(&(o)->kind, PICO_ONEXIT_EMPTY, memory_order_acquire)
+#define on_exit_top()         atomic_load_explicit(&on_exit_count, memory_order_acquire)
+#define on_exit_reset(top)    atomic_compare_exchange_strong(&on_exit_count, &(top), 0)
+
+#else
+
+static int
+on_exit_reserve(void)
+{
+    int o = -1;
+
+    __ATEXIT_LOCK();
+    if (on_exit_count < __ATEXIT_COUNT)
+        o = (int)on_exit_count++;
+    __ATEXIT_UNLOCK();
+    return o;
+}
+
+static enum pico_onexit_kind
+on_exit_claim(struct on_exit *o)
+{
+    enum pico_onexit_kind kind;
+
+    __ATEXIT_LOCK();
+    kind = o->kind;
+    o->kind = PICO_ONEXIT_EMPTY;
+    __ATEXIT_UNLOCK();
+    return kind;
+}
+
+#define on_exit_publish(o, k) \
+    do {                      \
+        __ATEXIT_LOCK();      \
+        (o)->kind = (k);      \
+        __ATEXIT_UNLOCK();    \
+    } while (0)
+#define on_exit_top() (on_exit_count)
+#define on_exit_reset(top)                     \
+    do {                                       \
+        __ATEXIT_LOCK();                       \
+        if (on_exit_count == (top))            \
+            on_exit_count = 0;                 \
+        __ATEXIT_UNLOCK();                     \
+    } while (0)
+
+#endif
 
 int
 _on_exit(enum pico_onexit_kind kind, union on_exit_func func, void *arg)
 {
-    int ret = -1;
-    int o;
-    __LIBC_LOCK();
-    for (o = 0; o < __ATEXIT_COUNT; o++) {
-        if (on_exits[o].kind == PICO_ONEXIT_EMPTY) {
-            on_exits[o].func = func;
-            on_exits[o].arg = arg;
-            on_exits[o].kind = kind;
-            ret = 0;
-            break;
-        }
-    }
-    __LIBC_UNLOCK();
-    return ret;
+    int o = on_exit_reserve();
+
+    if (o < 0)
+        return -1;
+    on_exits[o].func = func;
+    on_exits[o].arg = arg;
+    on_exit_publish(&on_exits[o], kind);
+    return 0;
 }
 
 /*
@@ -94,38 +167,42 @@ void
 __call_exitprocs(int code, void *param)
 #endif
 {
+    unsigned top = on_exit_top();
+    unsigned i = top;
+
     (void)param;
-    for (;;) {
-        int                   i;
-        union on_exit_func    func = { 0 };
-        enum pico_onexit_kind kind = PICO_ONEXIT_EMPTY;
-        void                 *arg = 0;
-
-        __LIBC_LOCK();
-        for (i = __ATEXIT_COUNT - 1; i >= 0; i--) {
-            kind = on_exits[i].kind;
-            if (kind != PICO_ONEXIT_EMPTY) {
-                func = on_exits[i].func;
-                arg = on_exits[i].arg;
-                memset(&on_exits[i], '\0', sizeof(struct on_exit));
-                break;
-            }
-        }
-        __LIBC_UNLOCK();
+    while (i > 0) {
+        struct on_exit       *o = &on_exits[--i];
+        enum pico_onexit_kind kind = (enum pico_onexit_kind)on_exit_claim(o);
+        unsigned              n;
+
         switch (kind) {
         case PICO_ONEXIT_EMPTY:
-            return;
+            continue;
         case PICO_ONEXIT_ONEXIT:
-            func.on_exit(code, arg);
+            o->func.on_exit(code, o->arg);
             break;
         case PICO_ONEXIT_ATEXIT:
-            func.atexit();
+            o->func.atexit();
             break;
         case PICO_ONEXIT_CXA_ATEXIT:
-            func.cxa_atexit(arg);
+            o->func.cxa_atexit(o->arg);
             break;
         }
+
+        /*
+         * Handlers registered by that one are newer than anything
+         * left, so they run next
+         */
+        n = on_exit_top();
+        if (n != top) {
+            top = n;
+            i = n;
+        }
     }
+
+    /* Everything has run; make the slots available again */
+    on_exit_reset(top);
 }
 
 #ifdef __INIT_FINI_ARRAY
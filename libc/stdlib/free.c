@@ -28,6 +28,52 @@
 
 #include "local-malloc.h"
 
+#ifdef __MALLOC_BOUNDARY_TAG
+
+/*
+ * Return a busy chunk to the free pool, merging it with any free
+ * neighbours found through the boundary tags. Called with the malloc
+ * lock held.
+ */
+void __disable_sanitizer
+__malloc_release(chunk_t *c)
+{
+    chunk_t *n;
+
+    if (!_is_bucket_size(_size(c))) {
+        /* Merge the following chunk into this one */
+        n = chunk_after(c);
+        if (_is_free(n) && !_is_bucket_size(_size(n))) {
+            __malloc_bin_remove(n);
+            *_size_ref(c) += _size(n);
+        }
+
+        /* Merge this chunk into the preceding one */
+        if (_prev_free(c)) {
+            n = chunk_before(c);
+            __malloc_bin_remove(n);
+            *_size_ref(n) += _size(c);
+            c = n;
+        }
+    }
+
+#if __MALLOC_SMALL_BUCKET
+    size_t s = _size(c);
+    if (_is_bucket_size(s)) {
+        int bucket = BUCKET_NUM(s);
+
+        _mark_free(c);
+        c->next = __malloc_bucket_list[bucket];
+        __malloc_bucket_list[bucket] = c;
+        return;
+    }
+#endif
+
+    __malloc_bin_insert(c);
+}
+
+#endif
+
 /*
  * Algorithm:
  *  Maintain a global free chunk_t single link list, headed by global
@@ -35,13 +81,19 @@
  *  When free, insert the to-be-freed chunk_t into free list. The place to
  *  insert should make sure all chunks are sorted by address from low to
  *  high.  Then merge with neighbor chunks if adjacent.
+ *
+ *  With __MALLOC_BOUNDARY_TAG, the neighbours are found through the
+ *  chunk heads and footers instead and the result goes into a bin.
  */
 
 void __disable_sanitizer
 __malloc_free(void *free_p)
 {
-    chunk_t  *p_to_free;
-    chunk_t **p, *c;
+    chunk_t      *p_to_free;
+    unsigned long start = malloc_profile_start();
+#ifndef __MALLOC_BOUNDARY_TAG
+    chunk_t     **p, *c;
+#endif
 
     if (free_p == NULL)
         return;
@@ -61,10 +113,19 @@ __malloc_free(void *free_p)
     __malloc_validate_chunk(p_to_free);
 #endif
 
+#ifdef __MALLOC_BOUNDARY_TAG
+    /* Neighbours look at the free bit, so only set it with the lock held */
+    MALLOC_LOCK;
+    malloc_profile_free(_size(p_to_free), start);
+    __malloc_release(p_to_free);
+    MALLOC_UNLOCK;
+#else
     _mark_free(p_to_free);
 
     MALLOC_LOCK;
 
+    malloc_profile_free(_size(p_to_free), start);
+
 #if __MALLOC_SMALL_BUCKET
     size_t s = _size(p_to_free);
     if (s <= MALLOC_MAX_BUCKET) {
@@ -145,6 +206,7 @@ no_insert:
 
 unlock:
     MALLOC_UNLOCK;
+#endif
 }
 
 #ifdef __strong_reference
@@ -64,8 +64,8 @@ getenv(const char *name)
     size_t offset;
     char  *entry;
 
-    __LIBC_LOCK();
+    __ENV_LOCK_SHARED();
     entry = __findenv(name, &offset);
-    __LIBC_UNLOCK();
+    __ENV_UNLOCK_SHARED();
     return entry;
 }
@@ -99,6 +99,22 @@ typedef union {
  * We can't use a single struct containing both size and next as that
  * may insert padding between the size and pointer fields when
  * pointers are larger than size_t.
+ *
+ * With __MALLOC_BOUNDARY_TAG, free chunks also hold a pointer to the
+ * previous free chunk in their bin and a copy of their size in the
+ * last word (the footer). The head of every chunk has a bit noting
+ * whether the chunk before it in memory is free; when set, the
+ * footer just below the head locates that chunk:
+ *
+ *          --------------------------------------
+ *    (head)| chunk size | prev free | free      |
+ *   chunk->| pointer to next free chunk in bin  |
+ *          | pointer to prev free chunk in bin  |
+ *          | ...                                |
+ *    (foot)| chunk size                         |
+ *          --------------------------------------
+ *
+ * free can then find and merge both neighbours in constant time.
  */
 
 typedef struct malloc_head {
@@ -107,6 +123,9 @@ typedef struct malloc_head {
 
 typedef struct malloc_chunk {
     struct malloc_chunk *next;
+#ifdef __MALLOC_BOUNDARY_TAG
+    struct malloc_chunk *prev;
+#endif
 } chunk_t;
 
 /* Alignment of allocated chunk. Compute the alignment required from a
@@ -129,7 +148,11 @@ typedef struct malloc_chunk {
 #define MALLOC_PAGE_ALIGN (0x1000)
 
 /* Minimum chunk size */
+#ifdef __MALLOC_BOUNDARY_TAG
+#define MALLOC_CHUNK_MIN __align_up(MALLOC_CHUNK_SIZE + 2 * MALLOC_HEAD_SIZE, MALLOC_CHUNK_ALIGN)
+#else
 #define MALLOC_CHUNK_MIN __align_up(MALLOC_CHUNK_SIZE + MALLOC_HEAD_SIZE, MALLOC_CHUNK_ALIGN)
+#endif
 
 /* Maximum chunk size */
 #define MALLOC_CHUNK_MAX (SIZE_MAX - 2 * MAX(MALLOC_CHUNK_SIZE, MALLOC_CHUNK_ALIGN))
@@ -143,32 +166,49 @@ _size_ref(chunk_t *chunk)
     return (size_t *)((char *)chunk - MALLOC_HEAD_SIZE);
 }
 
+/* Flag bits stored in the low bits of the size */
+#define MALLOC_FREE 1
+#ifdef __MALLOC_BOUNDARY_TAG
+#define MALLOC_PREV_FREE 2
+#else
+#define MALLOC_PREV_FREE 0
+#endif
+#define MALLOC_FLAGS (MALLOC_FREE | MALLOC_PREV_FREE)
+
 static inline void
 _mark_free(chunk_t *c)
 {
-    *_size_ref(c) |= 1;
+    *_size_ref(c) |= MALLOC_FREE;
 }
 
 static inline void
 _mark_busy(chunk_t *c)
 {
-    *_size_ref(c) &= ~(size_t)1;
+    *_size_ref(c) &= ~(size_t)MALLOC_FREE;
 }
 
 static inline bool
 _is_free(chunk_t *c)
 {
-    return *_size_ref(c) & 1;
+    return *_size_ref(c) & MALLOC_FREE;
 }
 
 static inline size_t
 _size(chunk_t *chunk)
 {
-    return *_size_ref(chunk) & ~(size_t)1;
+    return *_size_ref(chunk) & ~(size_t)MALLOC_FLAGS;
 }
 
+/* Set the size of an existing chunk, marking it busy */
 static inline void
 _set_size(chunk_t *chunk, size_t size)
+{
+    *_size_ref(chunk) = size | (*_size_ref(chunk) & MALLOC_PREV_FREE);
+}
+
+/* Set the size of a chunk carved out of the middle of another one */
+static inline void
+_init_size(chunk_t *chunk, size_t size)
 {
     *_size_ref(chunk) = size;
 }
@@ -187,23 +227,143 @@ void __malloc_validate(void);
 void __malloc_validate_chunk(chunk_t *c);
 #define MALLOC_LOCK          \
     do {                     \
-        __LIBC_LOCK();       \
+        __MALLOC_LOCK();       \
         __malloc_validate(); \
     } while (0)
 #define MALLOC_UNLOCK        \
     do {                     \
         __malloc_validate(); \
-        __LIBC_UNLOCK();     \
+        __MALLOC_UNLOCK();     \
     } while (0)
 #else
 #define __malloc_validate()
 #define __malloc_validate_chunk(c)
-#define MALLOC_LOCK   __LIBC_LOCK()
-#define MALLOC_UNLOCK __LIBC_UNLOCK()
+#define MALLOC_LOCK   __MALLOC_LOCK()
+#define MALLOC_UNLOCK __MALLOC_UNLOCK()
+#endif
+
+/* Count leading zero bits in a non-zero size_t */
+static inline int
+malloc_clz(size_t v)
+{
+    if (sizeof(size_t) == sizeof(unsigned int))
+        return __builtin_clz((unsigned int)v);
+    if (sizeof(size_t) == sizeof(unsigned long))
+        return __builtin_clzl((unsigned long)v);
+    return __builtin_clzll(v);
+}
+
+#ifdef __MALLOC_PROFILE
+
+extern struct malloc_profile __malloc_profile_data;
+
+extern unsigned long __malloc_profile_ticks(void) __weak;
+
+/* Number of bits needed to hold v, clamped to max - 1 */
+static inline int
+malloc_profile_bits(size_t v, int max)
+{
+    int bits = v ? (int)(sizeof(size_t) * 8) - malloc_clz(v) : 0;
+    return MIN(bits, max - 1);
+}
+
+static inline unsigned long
+malloc_profile_start(void)
+{
+    if (&__malloc_profile_ticks == NULL)
+        return 0;
+    return __malloc_profile_ticks();
+}
+
+static inline void
+malloc_profile_latency(size_t *hist, unsigned long start)
+{
+    if (&__malloc_profile_ticks != NULL)
+        hist[malloc_profile_bits(__malloc_profile_ticks() - start, MALLOC_PROFILE_LATENCY)]++;
+}
+
+/* These are all called with the malloc lock held */
+static inline void
+malloc_profile_grow(size_t size)
+{
+    struct malloc_profile *p = &__malloc_profile_data;
+
+    p->in_use += size;
+    if (p->in_use > p->peak)
+        p->peak = p->in_use;
+}
+
+static inline void
+malloc_profile_alloc(size_t size, void *caller, unsigned long start)
+{
+    struct malloc_profile *p = &__malloc_profile_data;
+
+    malloc_profile_grow(size);
+    p->size_class[malloc_profile_bits(size, MALLOC_PROFILE_CLASSES + 1) - 1]++;
+    if (p->nmalloc++ % MALLOC_PROFILE_SAMPLE == 0) {
+        struct malloc_profile_site *s = &p->site[p->nsite++ % MALLOC_PROFILE_SITES];
+        s->caller = caller;
+        s->size = size;
+    }
+    malloc_profile_latency(p->malloc_latency, start);
+}
+
+static inline void
+malloc_profile_free(size_t size, unsigned long start)
+{
+    struct malloc_profile *p = &__malloc_profile_data;
+
+    p->in_use -= size;
+    p->nfree++;
+    malloc_profile_latency(p->free_latency, start);
+}
+
+static inline void
+malloc_profile_fail(void)
+{
+    __malloc_profile_data.nfail++;
+}
+
+#else
+
+static inline unsigned long
+malloc_profile_start(void)
+{
+    return 0;
+}
+
+static inline void
+malloc_profile_grow(size_t size)
+{
+    (void)size;
+}
+
+static inline void
+malloc_profile_alloc(size_t size, void *caller, unsigned long start)
+{
+    (void)size;
+    (void)caller;
+    (void)start;
+}
+
+static inline void
+malloc_profile_free(size_t size, unsigned long start)
+{
+    (void)size;
+    (void)start;
+}
+
+static inline void
+malloc_profile_fail(void)
+{
+}
+
 #endif
 
 /* Forward data declarations */
+#ifndef __MALLOC_BOUNDARY_TAG
 extern chunk_t *__malloc_free_list;
+#endif
 extern char    *__malloc_sbrk_start;
 extern char    *__malloc_sbrk_top;
 
@@ -216,13 +376,26 @@ extern char    *__malloc_sbrk_top;
 
 #define MALLOC_MAX_BUCKET   (BUCKET_SIZE(MALLOC_MAX_BUCKET_POT - MIN_BUCKET_POT))
 
-#define MIN_BUCKET_POT      (UP_POT(MALLOC_CHUNK_MIN))
+#define MIN_BUCKET_POT      (UP_POT(MALLOC_CHUNK_MIN - BUCKET_EXTRA))
 #define MAX_BUCKET_POT      MALLOC_MAX_BUCKET_POT
 #define NUM_BUCKET_POT      (MAX_BUCKET_POT - MIN_BUCKET_POT + 1)
 
 #define BUCKET_NUM(s)       (UP_POT(s - BUCKET_EXTRA) - MIN_BUCKET_POT)
 
 extern chunk_t *__malloc_bucket_list[NUM_BUCKET_POT];
+
+static inline bool
+_is_bucket_size(size_t s)
+{
+    return s <= MALLOC_MAX_BUCKET && s == BUCKET_SIZE(BUCKET_NUM(s));
+}
+#else
+static inline bool
+_is_bucket_size(size_t s)
+{
+    (void)s;
+    return false;
+}
 #endif
 
 bool __malloc_grow_chunk(chunk_t *c, size_t new_size);
@@ -270,8 +443,7 @@ chunk_to_blob(chunk_t *c)
 static inline void * __disable_sanitizer
 chunk_end(chunk_t *c)
 {
-    size_t *s = _size_ref(c);
-    return (char *)s + *s;
+    return (char *)_size_ref(c) + _size(c);
 }
 
 /* next chunk in memory -- address of chunk header past this chunk */
@@ -316,6 +488,87 @@ chunk_usable(chunk_t *c)
 static inline void
 make_free_chunk(chunk_t *c, size_t size)
 {
-    _set_size(c, size);
+    _init_size(c, size);
     __malloc_free(chunk_to_ptr(c));
 }
+
+#ifdef __MALLOC_BOUNDARY_TAG
+
+/*
+ * Each region of memory obtained from sbrk ends with a busy,
+ * zero-sized head, so the last chunk never looks past the end of the
+ * region for a neighbour. When sbrk extends the region, the fence
+ * becomes the head of the new chunk.
+ */
+#define MALLOC_FENCE_SIZE __align_up(MALLOC_HEAD_SIZE, MALLOC_CHUNK_ALIGN)
+
+/* Free chunks are kept in one list per power of two */
+#define MALLOC_NUM_BINS (sizeof(size_t) * 8)
+
+extern chunk_t *__malloc_bins[MALLOC_NUM_BINS];
+extern size_t   __malloc_bin_map;
+extern size_t   __malloc_fence_count;
+
+static inline int
+malloc_bin(size_t size)
+{
+    return (int)(sizeof(size_t) * 8 - 1) - malloc_clz(size);
+}
+
+static inline bool
+_prev_free(chunk_t *c)
+{
+    return *_size_ref(c) & MALLOC_PREV_FREE;
+}
+
+/* footer holding the size of a free chunk */
+static inline size_t * __disable_sanitizer
+_foot_ref(chunk_t *c)
+{
+    return (size_t *)((char *)chunk_end(c) - MALLOC_HEAD_SIZE);
+}
+
+/* previous chunk in memory -- valid only when it is free */
+static inline __disable_sanitizer chunk_t *
+chunk_before(chunk_t *c)
+{
+    return (chunk_t *)((char *)c - _size_ref(c)[-1]);
+}
+
+/* Mark a chunk free and link it into its bin */
+static inline void __disable_sanitizer
+__malloc_bin_insert(chunk_t *c)
+{
+    size_t size = _size(c);
+    int    bin = malloc_bin(size);
+
+    _mark_free(c);
+    *_foot_ref(c) = size;
+    *_size_ref(chunk_after(c)) |= MALLOC_PREV_FREE;
+    c->prev = NULL;
+    c->next = __malloc_bins[bin];
+    if (c->next)
+        c->next->prev = c;
+    __malloc_bins[bin] = c;
+    __malloc_bin_map |= (size_t)1 << bin;
+}
+
+/* Unlink a chunk from its bin and mark it busy */
+static inline void __disable_sanitizer
+__malloc_bin_remove(chunk_t *c)
+{
+    int bin = malloc_bin(_size(c));
+
+    if (c->prev)
+        c->prev->next = c->next;
+    else if ((__malloc_bins[bin] = c->next) == NULL)
+        __malloc_bin_map &= ~((size_t)1 << bin);
+    if (c->next)
+        c->next->prev = c->prev;
+    _mark_busy(c);
+    *_size_ref(chunk_after(c)) &= ~(size_t)MALLOC_PREV_FREE;
+}
+
+void __malloc_release(chunk_t *c);
+
+#endif
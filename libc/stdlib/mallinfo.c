@@ -52,10 +52,19 @@ mallinfo(void)
             total_size = (size_t)(sbrk_now - __malloc_sbrk_start);
     }
 
+#ifdef __MALLOC_BOUNDARY_TAG
+    size_t bin;
+    for (bin = 0; bin < MALLOC_NUM_BINS; bin++)
+        for (pf = __malloc_bins[bin]; pf; pf = pf->next) {
+            ordblks++;
+            free_size += _size(pf);
+        }
+#else
     for (pf = __malloc_free_list; pf; pf = pf->next) {
         ordblks++;
         free_size += _size(pf);
     }
+#endif
 #if __MALLOC_SMALL_BUCKET
     size_t b;
     size_t smblks = 0;
@@ -75,6 +84,10 @@ mallinfo(void)
     current_mallinfo.arena = total_size;
     current_mallinfo.fordblks = free_size;
     current_mallinfo.uordblks = total_size - free_size - fsmblks;
+#ifdef __MALLOC_BOUNDARY_TAG
+    /* The fence at the end of each heap region is busy, but not in use */
+    current_mallinfo.uordblks -= __malloc_fence_count * MALLOC_FENCE_SIZE;
+#endif
 
     MALLOC_UNLOCK;
 
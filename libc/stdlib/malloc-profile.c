@@ -0,0 +1,99 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent <agent@local>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "local-malloc.h"
+
+#ifdef __MALLOC_PROFILE
+
+struct malloc_profile __malloc_profile_data;
+
+/* Copy the current profile data */
+void
+malloc_profile(struct malloc_profile *profile)
+{
+    MALLOC_LOCK;
+    *profile = __malloc_profile_data;
+    MALLOC_UNLOCK;
+}
+
+/* Clear the counters, leaving the current heap usage */
+void
+malloc_profile_reset(void)
+{
+    MALLOC_LOCK;
+    size_t in_use = __malloc_profile_data.in_use;
+    memset(&__malloc_profile_data, 0, sizeof(__malloc_profile_data));
+    __malloc_profile_data.in_use = in_use;
+    __malloc_profile_data.peak = in_use;
+    MALLOC_UNLOCK;
+}
+
+static void
+dump_hist(const char *name, const size_t *hist, int n)
+{
+    int i;
+
+    fprintf(stderr, "%s", name);
+    for (i = 0; i < n; i++)
+        if (hist[i])
+            fprintf(stderr, " %d:%zu", i, hist[i]);
+    fprintf(stderr, "\n");
+}
+
+/*
+ * Print the profile to stderr, one line per item. Histograms list
+ * only the non-empty entries as log2:count. Sampled sites are
+ * listed oldest first.
+ */
+void
+malloc_profile_dump(void)
+{
+    struct malloc_profile p;
+    size_t                i, n;
+
+    malloc_profile(&p);
+    fprintf(stderr, "heap in_use %zu peak %zu malloc %zu free %zu fail %zu\n", p.in_use, p.peak,
+            p.nmalloc, p.nfree, p.nfail);
+    dump_hist("size", p.size_class, MALLOC_PROFILE_CLASSES);
+    dump_hist("malloc_ticks", p.malloc_latency, MALLOC_PROFILE_LATENCY);
+    dump_hist("free_ticks", p.free_latency, MALLOC_PROFILE_LATENCY);
+    n = MIN(p.nsite, MALLOC_PROFILE_SITES);
+    for (i = p.nsite - n; i < p.nsite; i++) {
+        struct malloc_profile_site *s = &p.site[i % MALLOC_PROFILE_SITES];
+        fprintf(stderr, "site %p %zu\n", s->caller, s->size);
+    }
+}
+
+#endif
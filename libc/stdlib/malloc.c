@@ -28,8 +28,16 @@
 
 #include "local-malloc.h"
 
+#ifdef __MALLOC_BOUNDARY_TAG
+/* Free chunks, one list per power of two, and a mask of non-empty lists */
+chunk_t *__malloc_bins[MALLOC_NUM_BINS];
+size_t   __malloc_bin_map;
+
+_Static_assert(MALLOC_CHUNK_ALIGN > MALLOC_FLAGS, "chunk sizes must leave room for flags");
+#else
 /* List list header of free blocks */
 chunk_t *__malloc_free_list;
+#endif
 
 #if __MALLOC_SMALL_BUCKET
 chunk_t *__malloc_bucket_list[NUM_BUCKET_POT];
@@ -100,6 +108,124 @@ __malloc_sbrk_aligned(size_t s)
     return align_p;
 }
 
+#ifdef __MALLOC_BOUNDARY_TAG
+
+/* Number of heap regions, each of which ends with a fence */
+size_t __malloc_fence_count;
+
+/*
+ * Get a busy chunk of 's' bytes from sbrk. When the memory follows
+ * the current region, the fence at the end of that region becomes
+ * the head of the new chunk. Otherwise, this starts a new region and
+ * a little more memory is needed for its fence.
+ */
+static chunk_t *
+__malloc_sbrk_chunk(size_t s)
+{
+    char    *top = __malloc_sbrk_top;
+    char    *blob = __malloc_sbrk_aligned(s);
+    chunk_t *c;
+
+    if (blob == (char *)-1)
+        return NULL;
+
+    if (blob == top) {
+        c = blob_to_chunk(top - MALLOC_FENCE_SIZE);
+        _set_size(c, s);
+    } else {
+        if (sbrk(MALLOC_FENCE_SIZE) != blob + s)
+            return NULL;
+        __malloc_sbrk_top = blob + s + MALLOC_FENCE_SIZE;
+        __malloc_fence_count++;
+        c = blob_to_chunk(blob);
+        _init_size(c, s);
+    }
+
+    /* Write the new fence */
+    _init_size(chunk_after(c), 0);
+    return c;
+}
+
+bool
+__malloc_grow_chunk(chunk_t *c, size_t new_size)
+{
+    if ((char *)chunk_end(c) + MALLOC_FENCE_SIZE != __malloc_sbrk_top)
+        return false;
+
+    size_t   add_size = MAX(MALLOC_CHUNK_MIN, new_size - _size(c));
+    chunk_t *n = __malloc_sbrk_chunk(add_size);
+
+    /* Check if we got what we wanted */
+    if (n == chunk_after(c)) {
+        *_size_ref(c) += add_size;
+        return true;
+    }
+
+    /* sbrk returned unexpected memory, free it */
+    if (n)
+        __malloc_release(n);
+    return false;
+}
+
+/*
+ * Find a free chunk of at least 'alloc_size' bytes. Any chunk in a
+ * bin above the one for alloc_size is large enough, so only the
+ * first list needs searching.
+ */
+static chunk_t *
+__malloc_bin_alloc(size_t alloc_size)
+{
+    int      bin = malloc_bin(alloc_size);
+    size_t   map;
+    chunk_t *c;
+
+    for (c = __malloc_bins[bin]; c; c = c->next)
+        if (_size(c) >= alloc_size)
+            goto found;
+
+    map = __malloc_bin_map & ~(((size_t)2 << bin) - 1);
+    if (!map)
+        return NULL;
+    c = __malloc_bins[__builtin_ctzll(map)];
+
+found:
+    __malloc_bin_remove(c);
+
+    size_t rem = _size(c) - alloc_size;
+    if (rem >= MALLOC_CHUNK_MIN) {
+        /* Split off the tail and put it back */
+        _set_size(c, alloc_size);
+        chunk_t *s = chunk_after(c);
+        _init_size(s, rem);
+        __malloc_release(s);
+    }
+    return c;
+}
+
+/* Extend the free chunk at the end of the heap, if there is one */
+static chunk_t *
+__malloc_grow_last(size_t alloc_size)
+{
+    chunk_t *fence;
+    chunk_t *c;
+
+    if (__malloc_sbrk_top == NULL)
+        return NULL;
+
+    fence = blob_to_chunk(__malloc_sbrk_top - MALLOC_FENCE_SIZE);
+    if (!_prev_free(fence))
+        return NULL;
+
+    c = chunk_before(fence);
+    __malloc_bin_remove(c);
+    if (__malloc_grow_chunk(c, alloc_size))
+        return c;
+    __malloc_release(c);
+    return NULL;
+}
+
+#else
+
 bool
 __malloc_grow_chunk(chunk_t *c, size_t new_size)
 {
@@ -121,11 +247,14 @@ __malloc_grow_chunk(chunk_t *c, size_t new_size)
 
     if (heap != (char *)-1) {
         /* sbrk returned unexpected memory, free it */
+        malloc_profile_grow(add_size);
         make_free_chunk(blob_to_chunk(heap), add_size);
     }
     return false;
 }
 
+#endif
+
 /** Function malloc
  * Algorithm:
  *   Walk through the free list to find the first match. If fails to find
@@ -134,9 +263,13 @@ __malloc_grow_chunk(chunk_t *c, size_t new_size)
 void * __disable_sanitizer
 malloc(size_t s)
 {
-    chunk_t **p, *c;
-    char     *ptr;
-    size_t    alloc_size;
+    chunk_t      *c;
+#if __MALLOC_SMALL_BUCKET || !defined(__MALLOC_BOUNDARY_TAG)
+    chunk_t     **p;
+#endif
+    char         *ptr;
+    size_t        alloc_size;
+    unsigned long start = malloc_profile_start();
 
     if (s > MALLOC_ALLOC_MAX) {
         errno = ENOMEM;
@@ -158,6 +291,24 @@ malloc(size_t s)
             *p = c->next;
     } else
 #endif
+#ifdef __MALLOC_BOUNDARY_TAG
+    {
+        c = __malloc_bin_alloc(alloc_size);
+        if (c == NULL)
+            c = __malloc_grow_last(alloc_size);
+    }
+
+    /* Failed to find a appropriate chunk_t. Ask for more memory */
+    if (c == NULL) {
+        c = __malloc_sbrk_chunk(alloc_size);
+        if (c == NULL) {
+            errno = ENOMEM;
+            malloc_profile_fail();
+            MALLOC_UNLOCK;
+            return NULL;
+        }
+    }
+#else
     {
         for (p = &__malloc_free_list; (c = *p) != NULL; p = &c->next) {
             if (_size(c) >= alloc_size) {
@@ -218,12 +369,16 @@ malloc(size_t s)
         /* sbrk returns -1 if fail to allocate */
         if (blob == (void *)-1) {
             errno = ENOMEM;
+            malloc_profile_fail();
             MALLOC_UNLOCK;
             return NULL;
         }
         c = blob_to_chunk(blob);
         _set_size(c, alloc_size);
     }
+#endif
+
+    malloc_profile_alloc(_size(c), __builtin_return_address(0), start);
 
     MALLOC_UNLOCK;
 
@@ -262,6 +417,23 @@ __malloc_validate(void)
 {
     chunk_t *c;
 
+#ifdef __MALLOC_BOUNDARY_TAG
+    size_t bin;
+
+    for (bin = 0; bin < MALLOC_NUM_BINS; bin++) {
+        assert(!__malloc_bins[bin] == !(__malloc_bin_map & ((size_t)1 << bin)));
+        for (c = __malloc_bins[bin]; c; c = c->next) {
+            assert(_is_free(c));
+            __malloc_validate_chunk(c);
+            assert(malloc_bin(_size(c)) == (int)bin);
+            assert(!_is_bucket_size(_size(c)));
+            assert(*_foot_ref(c) == _size(c));
+            assert(_prev_free(chunk_after(c)));
+            assert(!_prev_free(c));
+            assert(c->next == NULL || c->next->prev == c);
+        }
+    }
+#else
     for (c = __malloc_free_list; c; c = c->next) {
         assert(_is_free(c));
         __malloc_validate_chunk(c);
@@ -274,6 +446,7 @@ __malloc_validate(void)
 #endif
         assert(c->next == NULL || chunk_after(c) <= c->next);
     }
+#endif
 #if __MALLOC_SMALL_BUCKET
     size_t b;
 
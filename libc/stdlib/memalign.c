@@ -87,9 +87,10 @@ memalign(size_t align, size_t s)
         }
 
         chunk_t *new_chunk_p = ptr_to_chunk(aligned_p);
-        _set_size(new_chunk_p, _size(chunk_p) - offset);
+        _init_size(new_chunk_p, _size(chunk_p) - offset);
 
-        make_free_chunk(chunk_p, offset);
+        _set_size(chunk_p, offset);
+        __malloc_free(chunk_to_ptr(chunk_p));
 
         chunk_p = new_chunk_p;
     }
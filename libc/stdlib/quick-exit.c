@@ -55,7 +55,7 @@ _at_quick_exit(enum pico_quick_exit_kind kind, union on_exit_func func, void *ar
 {
     int ret = -1;
     int o;
-    __LIBC_LOCK();
+    __AT_QUICK_EXIT_LOCK();
     for (o = 0; o < ATEXIT_MAX; o++) {
         if (quick_exits[o].kind == PICO_QUICK_EXIT_EMPTY) {
             quick_exits[o].func = func;
@@ -65,7 +65,7 @@ _at_quick_exit(enum pico_quick_exit_kind kind, union on_exit_func func, void *ar
             break;
         }
     }
-    __LIBC_UNLOCK();
+    __AT_QUICK_EXIT_UNLOCK();
     return ret;
 }
 
@@ -84,7 +84,7 @@ quick_exit(int code)
         enum pico_quick_exit_kind kind = PICO_QUICK_EXIT_EMPTY;
         void                     *arg = 0;
 
-        __LIBC_LOCK();
+        __AT_QUICK_EXIT_LOCK();
         for (i = ATEXIT_MAX - 1; i >= 0; i--) {
             kind = quick_exits[i].kind;
             if (kind != PICO_QUICK_EXIT_EMPTY) {
@@ -94,7 +94,7 @@ quick_exit(int code)
                 break;
             }
         }
-        __LIBC_UNLOCK();
+        __AT_QUICK_EXIT_UNLOCK();
         switch (kind) {
         case PICO_QUICK_EXIT_EMPTY:
             _Exit(code);
@@ -75,7 +75,8 @@ realloc(void *ptr, size_t size)
      * when increasing the size
      */
     if (!is_bucket && new_size > old_size) {
-        void *chunk_e = chunk_end(p_to_realloc);
+        void  *chunk_e = chunk_end(p_to_realloc);
+        size_t prev_size = old_size;
 
         MALLOC_LOCK;
 
@@ -85,6 +86,22 @@ realloc(void *ptr, size_t size)
             /* adjust chunk_t size */
             old_size = new_size;
         } else {
+#ifdef __MALLOC_BOUNDARY_TAG
+            chunk_t *r = chunk_after(p_to_realloc);
+
+            /* Merge in the following chunk if it is free */
+            if (_is_free(r) && !_is_bucket_size(_size(r))) {
+                size_t r_size = _size(r);
+
+                __malloc_bin_remove(r);
+
+                /* clear the memory from r, including its head */
+                memset(chunk_e, '\0', r_size);
+
+                old_size += r_size;
+                _set_size(p_to_realloc, old_size);
+            }
+#else
             chunk_t **p, *r;
 
             /* Check to see if there's a chunk_t of free space just past
@@ -108,8 +125,11 @@ realloc(void *ptr, size_t size)
                 if (p_to_realloc < r)
                     break;
             }
+#endif
         }
 
+        malloc_profile_grow(_size(p_to_realloc) - prev_size);
+
         MALLOC_UNLOCK;
     }
 
@@ -117,7 +137,7 @@ realloc(void *ptr, size_t size)
         size_t extra = old_size - new_size;
 
 #ifdef __MALLOC_CLEAR_FREED
-        memset((char *)ptr + size, 0, old_size - size);
+        memset((char *)ptr + size, 0, malloc_size(old_size) - size);
 #endif
         /* If there's enough space left over, split it out
          * and free it
@@ -62,19 +62,19 @@ setenv(const char *name, const char *value, int rewrite)
         new_environ = NULL;
         new_entry = NULL;
 
-        __LIBC_LOCK();
+        __ENV_LOCK();
 
         /* Record current sequence value */
         old_sequence = __environ_sequence;
 
         if ((cur_entry = __findenv(name, &offset))) { /* find if already exists */
             if (!rewrite) {
-                __LIBC_UNLOCK();
+                __ENV_UNLOCK();
                 return 0;
             }
             if (strlen(cur_entry) >= l_value) { /* old larger; copy over */
                 strcpy(cur_entry, value);
-                __LIBC_UNLOCK();
+                __ENV_UNLOCK();
                 return 0;
             }
         } else { /* create new slot */
@@ -84,13 +84,13 @@ setenv(const char *name, const char *value, int rewrite)
             for (env = environ; *env; ++env)
                 n_environ++;
 
-            __LIBC_UNLOCK();
+            __ENV_UNLOCK();
 
             new_environ = calloc(n_environ + 2, sizeof(char *));
             if (!new_environ)
                 return -1;
 
-            __LIBC_LOCK();
+            __ENV_LOCK();
             if (__environ_sequence != old_sequence)
                 goto retry;
 
@@ -99,7 +99,7 @@ setenv(const char *name, const char *value, int rewrite)
             offset = n_environ;
         }
 
-        __LIBC_UNLOCK();
+        __ENV_UNLOCK();
 
         l_name = strlen(name);
 
@@ -114,13 +114,13 @@ setenv(const char *name, const char *value, int rewrite)
         *eq++ = '=';
         strcpy(eq, value);
 
-        __LIBC_LOCK();
+        __ENV_LOCK();
 
         if (__environ_sequence == old_sequence)
             break;
 
     retry:
-        __LIBC_UNLOCK();
+        __ENV_UNLOCK();
         free(new_environ);
         free(new_entry);
     }
@@ -137,7 +137,7 @@ setenv(const char *name, const char *value, int rewrite)
 
     environ[offset] = new_entry;
 
-    __LIBC_UNLOCK();
+    __ENV_UNLOCK();
 
     return 0;
 }
@@ -42,7 +42,7 @@ unsetenv(const char *name)
         return -1;
     }
 
-    __LIBC_LOCK();
+    __ENV_LOCK();
 
     while (__findenv(name, &offset)) /* if set multiple times */
     {
@@ -53,6 +53,6 @@ unsetenv(const char *name)
 
     ++__environ_sequence;
 
-    __LIBC_UNLOCK();
+    __ENV_UNLOCK();
     return 0;
 }
@@ -28,6 +28,11 @@ No supporting OS subroutine calls are required.
 
 #define _DEFAULT_SOURCE
 #include <stdlib.h>
+#include <limits.h>
+
+#ifdef __IO_DIGIT_PAIRS
+#include "../stdio/ryu/digit_table.h"
+#endif
 
 char *
 __utoa(unsigned value, char *str, int base)
@@ -43,6 +48,37 @@ __utoa(unsigned value, char *str, int base)
         return NULL;
     }
 
+#ifdef __IO_DIGIT_PAIRS
+    if (base == 10) {
+        unsigned power = 10;
+
+        /* Count digits so they can be written in order.  */
+        for (i = 1; value >= power; i++) {
+            if (power > UINT_MAX / 10) {
+                i++;
+                break;
+            }
+            power *= 10;
+        }
+        str[i] = '\0';
+
+        /* Convert two digits at a time from the end.  */
+        while (value >= 100) {
+            remainder = (value % 100) * 2;
+            value /= 100;
+            str[--i] = DIGIT_TABLE[remainder + 1];
+            str[--i] = DIGIT_TABLE[remainder];
+        }
+        if (value >= 10) {
+            str[1] = DIGIT_TABLE[value * 2 + 1];
+            str[0] = DIGIT_TABLE[value * 2];
+        } else {
+            str[0] = digits[value];
+        }
+        return str;
+    }
+#endif
+
     /* Convert to string. Digits are in reverse order.  */
     i = 0;
     do {
@@ -37,32 +37,6 @@ WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE.
 #include <limits.h>
 #include <errno.h>
 
-/* Move epoch from 01.01.1970 to 01.03.0000 (yes, Year 0) - this is the first
- * day of a 400-year long "era", right after additional day of leap year.
- * This adjustment is required only for date calculation, so instead of
- * modifying time_t value (which would require 64-bit operations to work
- * correctly) it's enough to adjust the calculated number of days since epoch.
- */
-#define EPOCH_ADJUSTMENT_DAYS 719468L
-/* year to which the adjustment was made */
-#define ADJUSTED_EPOCH_YEAR 0
-/* 1st March of year 0 is Wednesday */
-#define ADJUSTED_EPOCH_WDAY 3
-/* there are 97 leap years in 400-year periods. ((400 - 97) * 365 + 97 * 366) */
-#define DAYS_PER_ERA 146097L
-/* there are 24 leap years in 100-year periods. ((100 - 24) * 365 + 24 * 366) */
-#define DAYS_PER_CENTURY 36524L
-/* there is one leap year every 4 years */
-#define DAYS_PER_4_YEARS (3 * 365 + 366)
-/* number of days in a non-leap year */
-#define DAYS_PER_YEAR 365
-/* number of days in January */
-#define DAYS_IN_JANUARY 31
-/* number of days in non-leap February */
-#define DAYS_IN_FEBRUARY 28
-/* number of years per era */
-#define YEARS_PER_ERA 400
-
 struct tm *
 gmtime_r(const time_t * __restrict tim_p, struct tm * __restrict res)
 {
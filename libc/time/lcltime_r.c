@@ -48,7 +48,7 @@ localtime_r(const time_t * __restrict tim_p, struct tm * __restrict res)
 
     tzset();
 
-    __LIBC_LOCK();
+    __TZ_LOCK();
 
     if (daylight) {
         if (year == __tzinfo.year || __tzcalc_limits(year))
@@ -120,7 +120,7 @@ localtime_r(const time_t * __restrict tim_p, struct tm * __restrict res)
             res->tm_mday = ip[res->tm_mon];
         }
     }
-    __LIBC_UNLOCK();
+    __TZ_UNLOCK();
 
     return (res);
 }
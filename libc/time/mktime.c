@@ -80,14 +80,55 @@ ANSI C requires <<mktime>>.
 #include <time.h>
 #include <errno.h>
 #include <stdbool.h>
-
-#define _DAYS_IN_MONTH(x) ((x == 1) ? days_in_feb : __month_lengths[0][x])
+#include <limits.h>
 
 static const int16_t _DAYS_BEFORE_MONTH[12]
     = { 0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334 };
 
 #define _DAYS_IN_YEAR(year) (365 + isleap2(year, YEAR_BASE))
 
+/*
+ * Days from 1970-01-01 to the first day of month 'mon' [0, 11] of
+ * 'year' (years since 1900). This is days_from_civil from
+ * http://howardhinnant.github.io/date_algorithms.html, the inverse
+ * of the computation in gmtime_r.
+ */
+static int64_t
+days_from_civil(int64_t year, int mon)
+{
+    int64_t  y = year + YEAR_BASE - (mon < 2);
+    int64_t  era = (y >= 0 ? y : y - (YEARS_PER_ERA - 1)) / YEARS_PER_ERA;
+    unsigned erayear = (unsigned)(y - era * YEARS_PER_ERA);                    /* [0, 399] */
+    unsigned yearday = (153 * (unsigned)(mon < 2 ? mon + 10 : mon - 2) + 2) / 5; /* [0, 306] */
+    unsigned eraday = erayear * DAYS_PER_YEAR + erayear / 4 - erayear / 100 + yearday;
+
+    return era * DAYS_PER_ERA + eraday - EPOCH_ADJUSTMENT_DAYS;
+}
+
+/*
+ * Split days since 1970-01-01 into year (since 1900), month and day of
+ * month, as gmtime_r does.
+ */
+static void
+civil_from_days(int64_t days, int64_t *year_p, int *mon_p, int *mday_p)
+{
+    int64_t  era;
+    unsigned eraday, erayear, yearday, month;
+
+    days += EPOCH_ADJUSTMENT_DAYS;
+    era = (days >= 0 ? days : days - (DAYS_PER_ERA - 1)) / DAYS_PER_ERA;
+    eraday = (unsigned)(days - era * DAYS_PER_ERA);
+    erayear = (eraday - eraday / (DAYS_PER_4_YEARS - 1) + eraday / DAYS_PER_CENTURY
+               - eraday / (DAYS_PER_ERA - 1))
+        / DAYS_PER_YEAR;
+    yearday = eraday - (DAYS_PER_YEAR * erayear + erayear / 4 - erayear / 100);
+    month = (5 * yearday + 2) / 153;
+    *mday_p = yearday - (153 * month + 2) / 5 + 1;
+    month += month < 10 ? 2 : -10;
+    *mon_p = month;
+    *year_p = ADJUSTED_EPOCH_YEAR + erayear + era * YEARS_PER_ERA + (month <= 1) - YEAR_BASE;
+}
+
 static void
 set_tm_wday(time_t days, struct tm *tim_p)
 {
@@ -98,9 +139,9 @@ set_tm_wday(time_t days, struct tm *tim_p)
 static bool
 validate_structure(struct tm *tim_p)
 {
-    div_t res;
-    int   days_in_feb = 28;
-    int   year_off = 0;
+    div_t   res;
+    int64_t year = tim_p->tm_year;
+    int     mon = tim_p->tm_mon;
 
     /* calculate time & date to account for out of range values */
     if (tim_p->tm_sec < 0 || tim_p->tm_sec > 59) {
@@ -130,51 +171,43 @@ validate_structure(struct tm *tim_p)
         }
     }
 
-    if (tim_p->tm_mon < 0 || tim_p->tm_mon > 11) {
-        res = div(tim_p->tm_mon, 12);
-        year_off += res.quot;
-        if ((tim_p->tm_mon = res.rem) < 0) {
-            tim_p->tm_mon += 12;
-            year_off--;
+    if (mon < 0 || mon > 11) {
+        res = div(mon, 12);
+        year += res.quot;
+        if ((mon = res.rem) < 0) {
+            mon += 12;
+            year--;
         }
     }
 
-    if (isleap2(tim_p->tm_year, year_off + YEAR_BASE))
-        days_in_feb = 29;
-
-    if (tim_p->tm_mday <= 0) {
-        while (tim_p->tm_mday <= 0) {
-            if (--tim_p->tm_mon == -1) {
-                year_off--;
-                tim_p->tm_mon = 11;
-                days_in_feb = (isleap2(tim_p->tm_year, year_off + YEAR_BASE) ? 29 : 28);
-            }
-            tim_p->tm_mday += _DAYS_IN_MONTH(tim_p->tm_mon);
-        }
-    } else {
-        while (tim_p->tm_mday > _DAYS_IN_MONTH(tim_p->tm_mon)) {
-            tim_p->tm_mday -= _DAYS_IN_MONTH(tim_p->tm_mon);
-            if (++tim_p->tm_mon == 12) {
-                year_off++;
-                tim_p->tm_mon = 0;
-                days_in_feb = (isleap2(tim_p->tm_year, year_off + YEAR_BASE) ? 29 : 28);
-            }
-        }
+    /*
+     * Days past the end of the month (or before the start) are folded
+     * into the month and year with the closed-form day count rather
+     * than by stepping through the months one at a time.
+     */
+    if (tim_p->tm_mday < 1
+        || (tim_p->tm_mday > 28
+            && tim_p->tm_mday
+                > __month_lengths[isleap((int)(year % YEARS_PER_ERA) + YEAR_BASE)][mon])) {
+        civil_from_days(days_from_civil(year, mon) + tim_p->tm_mday - 1, &year, &mon,
+                        &tim_p->tm_mday);
     }
 
-    if (__picolibc_add_overflow(tim_p->tm_year, year_off, &tim_p->tm_year))
+    if (year < INT_MIN || year > INT_MAX)
         return false;
 
+    tim_p->tm_year = (int)year;
+    tim_p->tm_mon = mon;
+
     return true;
 }
 
 static time_t
 mktime_utc(struct tm *tim_p, time_t *days_p)
 {
-    time_t tim = 0;
-    time_t days = 0;
-    int    year;
-    time_t daysecs;
+    time_t  tim = 0;
+    int64_t days;
+    time_t  daysecs;
 
     /* validate structure */
     if (!validate_structure(tim_p))
@@ -183,60 +216,19 @@ mktime_utc(struct tm *tim_p, time_t *days_p)
     /* compute hours, minutes, seconds */
     tim += tim_p->tm_sec + (tim_p->tm_min * SECSPERMIN) + (tim_p->tm_hour * SECSPERHOUR);
 
-    /* compute days in year */
-    days += tim_p->tm_mday - 1;
-    days += _DAYS_BEFORE_MONTH[tim_p->tm_mon];
-    if (tim_p->tm_mon > 1 && isleap2(tim_p->tm_year, YEAR_BASE))
-        days++;
-
     /* compute day of the year */
-    tim_p->tm_yday = days;
-
-    year = tim_p->tm_year;
-
-#define DAYSPERHCEN 3652425
-
-#define TIME_T_MAX  ((sizeof(time_t) < 8) ? INT32_MAX : INT64_MAX)
-#define TIME_T_MIN  ((sizeof(time_t) < 8) ? INT32_MIN : INT64_MIN)
-
-#define DAY_MAX     (TIME_T_MAX / SECSPERDAY)
-#define DAY_MIN     (TIME_T_MIN / SECSPERDAY)
-#define HCEN_MAX    (TIME_T_MAX / DAYSPERHCEN)
-#define HCEN_MIN    (TIME_T_MIN / DAYSPERHCEN)
-
-    if (sizeof(time_t) > 4) {
-        long hundredcentury;
-
-        /*
-         * Split out the multiple of 10000 as those are an exact integer
-         * number of days
-         */
-        if (year > 0)
-            hundredcentury = year / 10000;
-        else
-            hundredcentury = (int)-(-(unsigned)year / 10000);
-
-        year = year - hundredcentury * 10000;
+    tim_p->tm_yday = _DAYS_BEFORE_MONTH[tim_p->tm_mon] + tim_p->tm_mday - 1;
+    if (tim_p->tm_mon > 1 && isleap2(tim_p->tm_year, YEAR_BASE))
+        tim_p->tm_yday++;
 
-#if __SIZEOF_INT__ > 4
-        if (hundredcentury < HCEN_MIN || HCEN_MAX < hundredcentury)
-            goto overflow;
-#endif
+    /* compute days since the epoch */
+    days = days_from_civil(tim_p->tm_year, 0) + tim_p->tm_yday;
 
-        days += (time_t)hundredcentury * DAYSPERHCEN;
-    }
+#define TIME_T_MAX ((sizeof(time_t) < 8) ? INT32_MAX : INT64_MAX)
+#define TIME_T_MIN ((sizeof(time_t) < 8) ? INT32_MIN : INT64_MIN)
 
-    /* compute days in other years */
-    if (year > 70) {
-        long y;
-        for (y = 70; y < year; y++)
-            days += _DAYS_IN_YEAR(y);
-    } else if (year < 70) {
-        long y;
-        for (y = 69; y > year; y--)
-            days -= _DAYS_IN_YEAR(y);
-        days -= _DAYS_IN_YEAR(y);
-    }
+#define DAY_MAX    (TIME_T_MAX / SECSPERDAY)
+#define DAY_MIN    (TIME_T_MIN / SECSPERDAY)
 
     if (days < DAY_MIN || DAY_MAX < days)
         goto overflow;
@@ -274,7 +266,7 @@ mktime(struct tm *tim_p)
 
     tzset();
 
-    __LIBC_LOCK();
+    __TZ_LOCK();
 
     if (daylight) {
         int tm_isdst;
@@ -344,7 +336,7 @@ mktime(struct tm *tim_p)
     else /* otherwise assume std time */
         offset = (time_t)__tzinfo.rule[0].offset;
 
-    __LIBC_UNLOCK();
+    __TZ_UNLOCK();
 
     if ((offset > 0 && (tim + offset) < tim) || (offset < 0 && (tim + offset) > tim)) {
         errno = EOVERFLOW;
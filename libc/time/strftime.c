@@ -1069,12 +1069,12 @@ __strftime(CHAR *s, size_t maxsize, const CHAR *format, const struct tm *tim_p,
                         tzset();
                     }
 
-                    __LIBC_LOCK();
+                    __TZ_LOCK();
                     /* The sign of this is exactly opposite the envvar TZ.  We
                        could directly use the global _timezone for tm_isdst==0,
                        but have to use __tzrule for daylight savings.  */
                     offset = -__tzinfo.rule[tim_p->tm_isdst > 0].offset;
-                    __LIBC_UNLOCK();
+                    __TZ_UNLOCK();
                 }
                 len = t_snprintf(&s[count], maxsize - count, CQ("%lld"),
                                  (((((long long)tim_p->tm_year - 69) / 4
@@ -1270,12 +1270,12 @@ __strftime(CHAR *s, size_t maxsize, const CHAR *format, const struct tm *tim_p,
                     tzset_called = 1;
                 }
 
-                __LIBC_LOCK();
+                __TZ_LOCK();
                 /* The sign of this is exactly opposite the envvar TZ.  We
                    could directly use the global _timezone for tm_isdst==0,
                    but have to use __tzrule for daylight savings.  */
                 offset = -__tzinfo.rule[tim_p->tm_isdst > 0].offset;
-                __LIBC_UNLOCK();
+                __TZ_UNLOCK();
 
                 len = t_snprintf(&s[count], maxsize - count, CQ("%+03ld%.2ld"),
                                  offset / SECSPERHOUR, labs(offset / SECSPERMIN) % 60L);
@@ -1292,7 +1292,7 @@ __strftime(CHAR *s, size_t maxsize, const CHAR *format, const struct tm *tim_p,
                     tzset_called = 1;
                 }
 
-                __LIBC_LOCK();
+                __TZ_LOCK();
                 tznam = tzname[tim_p->tm_isdst > 0];
                 /* Note that in case of wcsftime this loop only works for
                    timezone abbreviations using the portable codeset (aka ASCII).
@@ -1303,11 +1303,11 @@ __strftime(CHAR *s, size_t maxsize, const CHAR *format, const struct tm *tim_p,
                     if (count < maxsize - 1)
                         s[count++] = tznam[i];
                     else {
-                        __LIBC_UNLOCK();
+                        __TZ_UNLOCK();
                         return 0;
                     }
                 }
-                __LIBC_UNLOCK();
+                __TZ_UNLOCK();
             }
             break;
         case CQ('%'):
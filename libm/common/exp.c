@@ -32,6 +32,7 @@
 #include <math.h>
 #include <stdint.h>
 #include "math_config.h"
+#include "exp_core.h"
 
 #define N         (1 << EXP_TABLE_BITS)
 #define InvLn2N   __exp_data.invln2N
@@ -45,51 +46,6 @@
 #define C5        __exp_data.poly[8 - EXP_POLY_ORDER]
 #define C6        __exp_data.poly[9 - EXP_POLY_ORDER]
 
-/* Handle cases that may overflow or underflow when computing the result that
-   is scale*(1+TMP) without intermediate rounding.  The bit representation of
-   scale is in SBITS, however it has a computed exponent that may have
-   overflown into the sign bit so that needs to be adjusted before using it as
-   a double.  (int32_t)KI is the k used in the argument reduction and exponent
-   adjustment of scale, positive k here means the result may overflow and
-   negative k means the result may underflow.  */
-static inline double
-specialcase(double_t tmp, uint64_t sbits, uint64_t ki)
-{
-    double_t scale, y;
-
-    if ((ki & 0x80000000) == 0) {
-        /* k > 0, the exponent of scale might have overflowed by <= 460.  */
-        sbits -= 1009ull << 52;
-        scale = asfloat64(sbits);
-        y = 0x1p1009 * (scale + scale * tmp);
-        return check_oflow(y);
-    }
-    /* k < 0, need special care in the subnormal range.  */
-    sbits += 1022ull << 52;
-    scale = asfloat64(sbits);
-    y = scale + scale * tmp;
-    if (y < 1.0) {
-        /* Round y to the right precision before scaling it into the subnormal
-           range to avoid double rounding that can cause 0.5+E/2 ulp error where
-           E is the worst-case ulp error outside the subnormal range.  So this
-           is only useful if the goal is better than 1 ulp worst-case error.  */
-        double_t hi, lo;
-        lo = scale - y + scale * tmp;
-        hi = 1.0 + y;
-        lo = 1.0 - hi + y + lo;
-        y = eval_as_double(hi + lo) - 1.0;
-        /* Avoid -0.0 with downward rounding.  */
-#if WANT_ROUNDING
-        if (y == 0.0)
-            y = 0.0;
-#endif
-        /* The underflow exception needs to be signaled explicitly.  */
-        force_eval_double(opt_barrier_double(0x1p-1022) * 0x1p-1022);
-    }
-    y = 0x1p-1022 * y;
-    return check_uflow(y);
-}
-
 /* Top 12 bits of a double (sign and exponent bits).  */
 static inline uint32_t
 top12(double x)
@@ -166,7 +122,7 @@ exp(double x)
     tmp = tail + r + r2 * (0.5 + r * C3) + r2 * r2 * (C4 + r * C5 + r2 * C6);
 #endif
     if (unlikely(abstop == 0))
-        return specialcase(tmp, sbits, ki);
+        return exp_specialcase(tmp, sbits, ki);
     scale = asfloat64(sbits);
     /* Note: tmp == 0 or |tmp| > 2^-65 and scale > 2^-739, so there
        is no spurious underflow here even without fma.  */
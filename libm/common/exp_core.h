@@ -0,0 +1,184 @@
+/* Shared e^x evaluation for functions built on exp and expf.
+   Copyright (c) 2018 Arm Ltd.  All rights reserved.
+
+   SPDX-License-Identifier: BSD-3-Clause
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+   1. Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+   2. Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+   3. The name of the company may not be used to endorse or promote
+      products derived from this software without specific prior written
+      permission.
+
+   THIS SOFTWARE IS PROVIDED BY ARM LTD ``AS IS'' AND ANY EXPRESS OR IMPLIED
+   WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+   MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+   IN NO EVENT SHALL ARM LTD BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+   TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE. */
+
+
+#ifndef _EXP_CORE_H_
+#define _EXP_CORE_H_
+
+#include <math.h>
+#include <stdint.h>
+#include "math_config.h"
+
+#if !__OBSOLETE_MATH_DOUBLE
+
+/* Handle cases that may overflow or underflow when computing the result that
+   is scale*(1+TMP) without intermediate rounding.  The bit representation of
+   scale is in SBITS, however it has a computed exponent that may have
+   overflown into the sign bit so that needs to be adjusted before using it as
+   a double.  (int32_t)KI is the k used in the argument reduction and exponent
+   adjustment of scale, positive k here means the result may overflow and
+   negative k means the result may underflow.  */
+static inline double
+exp_specialcase(double_t tmp, uint64_t sbits, uint64_t ki)
+{
+    double_t scale, y;
+
+    if ((ki & 0x80000000) == 0) {
+        /* k > 0, the exponent of scale might have overflowed by <= 460.  */
+        sbits -= 1009ull << 52;
+        scale = asfloat64(sbits);
+        y = 0x1p1009 * (scale + scale * tmp);
+        return check_oflow(y);
+    }
+    /* k < 0, need special care in the subnormal range.  */
+    sbits += 1022ull << 52;
+    scale = asfloat64(sbits);
+    y = scale + scale * tmp;
+    if (y < 1.0) {
+        /* Round y to the right precision before scaling it into the subnormal
+           range to avoid double rounding that can cause 0.5+E/2 ulp error where
+           E is the worst-case ulp error outside the subnormal range.  So this
+           is only useful if the goal is better than 1 ulp worst-case error.  */
+        double_t hi, lo;
+        lo = scale - y + scale * tmp;
+        hi = 1.0 + y;
+        lo = 1.0 - hi + y + lo;
+        y = eval_as_double(hi + lo) - 1.0;
+        /* Avoid -0.0 with downward rounding.  */
+#if WANT_ROUNDING
+        if (y == 0.0)
+            y = 0.0;
+#endif
+        /* The underflow exception needs to be signaled explicitly.  */
+        force_eval_double(opt_barrier_double(0x1p-1022) * 0x1p-1022);
+    }
+    y = 0x1p-1022 * y;
+    return check_uflow(y);
+}
+
+#define XC2 __exp_data.poly[5 - EXP_POLY_ORDER]
+#define XC3 __exp_data.poly[6 - EXP_POLY_ORDER]
+#define XC4 __exp_data.poly[7 - EXP_POLY_ORDER]
+#define XC5 __exp_data.poly[8 - EXP_POLY_ORDER]
+#define XC6 __exp_data.poly[9 - EXP_POLY_ORDER]
+
+/* Computes e^(x+xtail) ~= scale * (1 + tmp) with the reduction and
+   polynomial used by exp, for 2^-54 < |x| < 1024 and |xtail| < 2^-8/N.
+   The bits of scale are stored in *SBITS and k in *KI.  scale is a valid
+   double only for |x| < 512; otherwise pass tmp, *SBITS and *KI on to
+   exp_specialcase.  */
+static inline double_t
+exp_core(double_t x, double_t xtail, uint64_t *sbits, uint64_t *ki)
+{
+    uint64_t idx, top;
+    double_t kd, z, r, r2, tail;
+
+    /* exp(x) = 2^(k/N) * exp(r), with exp(r) in [2^(-1/2N),2^(1/2N)].  */
+    /* x = ln2/N*k + r, with int k and r in [-ln2/2N, ln2/2N].  */
+    z = __exp_data.invln2N * x;
+#if TOINT_INTRINSICS
+    kd = roundtoint(z);
+    *ki = converttoint(z);
+#elif EXP_USE_TOINT_NARROW
+    /* z - kd is in [-0.5-2^-16, 0.5] in all rounding modes.  */
+    kd = eval_as_double(z + __exp_data.shift);
+    *ki = asuint64(kd) >> 16;
+    kd = (double_t)(int32_t)*ki;
+#else
+    /* z - kd is in [-1, 1] in non-nearest rounding modes.  */
+    kd = eval_as_double(z + __exp_data.shift);
+    *ki = asuint64(kd);
+    kd -= __exp_data.shift;
+#endif
+    r = x + kd * __exp_data.negln2hiN + kd * __exp_data.negln2loN;
+    r += xtail;
+    /* 2^(k/N) ~= scale * (1 + tail).  */
+    idx = 2 * (*ki % (1 << EXP_TABLE_BITS));
+    top = *ki << (52 - EXP_TABLE_BITS);
+    tail = asfloat64(__exp_data.tab[idx]);
+    /* This is only a valid scale when -1023*N < k < 1024*N.  */
+    *sbits = __exp_data.tab[idx + 1] + top;
+    /* exp(x) = 2^(k/N) * exp(r) ~= scale + scale * (tail + exp(r) - 1).  */
+    r2 = r * r;
+#if EXP_POLY_ORDER == 4
+    return tail + r + r2 * XC2 + r * r2 * (XC3 + r * XC4);
+#elif EXP_POLY_ORDER == 5
+    return tail + r + r2 * (XC2 + r * XC3) + r2 * r2 * (XC4 + r * XC5);
+#elif EXP_POLY_ORDER == 6
+    return tail + r + r2 * (0.5 + r * XC3) + r2 * r2 * (XC4 + r * XC5 + r2 * XC6);
+#endif
+}
+
+#undef XC2
+#undef XC3
+#undef XC4
+#undef XC5
+#undef XC6
+
+#endif /* !__OBSOLETE_MATH_DOUBLE */
+
+#if !__OBSOLETE_MATH_FLOAT
+
+/* e^xd in double precision with the expf reduction and polynomial, for
+   |xd| < 150 ln2.  The relative error is below 1.7 * 2^-34.  */
+static inline double_t
+expf_core(double_t xd)
+{
+    uint64_t ki, t;
+    double_t kd, z, r, r2, y, s;
+
+    /* x*N/Ln2 = k + r with r in [-1/2, 1/2] and int k.  */
+    z = __exp2f_data.invln2_scaled * xd;
+
+    /* Round and convert z to int, the result is in [-150*N, 128*N] and
+       ideally ties-to-even rule is used, otherwise the magnitude of r
+       can be bigger which gives larger approximation error.  */
+#if TOINT_INTRINSICS
+    kd = roundtoint(z);
+    ki = converttoint(z);
+#else
+    kd = (double)(z + __exp2f_data.shift); /* Rounding to double precision is required.  */
+    ki = asuint64(kd);
+    kd -= __exp2f_data.shift;
+#endif
+    r = z - kd;
+
+    /* exp(x) = 2^(k/N) * 2^(r/N) ~= s * (C0*r^3 + C1*r^2 + C2*r + 1) */
+    t = __exp2f_data.tab[ki % (1 << EXP2F_TABLE_BITS)];
+    t += ki << (52 - EXP2F_TABLE_BITS);
+    s = asfloat64(t);
+    z = __exp2f_data.poly_scaled[0] * r + __exp2f_data.poly_scaled[1];
+    r2 = r * r;
+    y = __exp2f_data.poly_scaled[2] * r + 1;
+    y = z * r2 + y;
+    return y * s;
+}
+
+#endif /* !__OBSOLETE_MATH_FLOAT */
+
+#endif /* _EXP_CORE_H_ */
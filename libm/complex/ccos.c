@@ -69,8 +69,9 @@ QUICKREF
 double complex
 ccos(double complex z)
 {
-    double ch, sh;
+    double ch, sh, s, c;
 
     _cchsh(cimag(z), &ch, &sh);
-    return CMPLX(cos(creal(z)) * ch, -(sin(creal(z)) * sh));
+    sincos(creal(z), &s, &c);
+    return CMPLX(c * ch, -(s * sh));
 }
@@ -37,8 +37,9 @@
 float complex
 ccosf(float complex z)
 {
-    float ch, sh;
+    float ch, sh, s, c;
 
     _cchshf(cimagf(z), &ch, &sh);
-    return CMPLXF(cosf(crealf(z)) * ch, -(sinf(crealf(z)) * sh));
+    sincosf(crealf(z), &s, &c);
+    return CMPLXF(c * ch, -(s * sh));
 }
@@ -69,9 +69,9 @@ QUICKREF
 double complex
 ccosh(double complex z)
 {
-    double x, y;
+    double ch, sh, s, c;
 
-    x = creal(z);
-    y = cimag(z);
-    return CMPLX(cosh(x) * cos(y), sinh(x) * sin(y));
+    _cchsh(creal(z), &ch, &sh);
+    sincos(cimag(z), &s, &c);
+    return CMPLX(ch * c, sh * s);
 }
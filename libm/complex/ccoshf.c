@@ -37,9 +37,9 @@
 float complex
 ccoshf(float complex z)
 {
-    float x, y;
+    float ch, sh, s, c;
 
-    x = crealf(z);
-    y = cimagf(z);
-    return CMPLXF(coshf(x) * cosf(y), (sinhf(x) * sinf(y)));
+    _cchshf(crealf(z), &ch, &sh);
+    sincosf(cimagf(z), &s, &c);
+    return CMPLXF(ch * c, sh * s);
 }
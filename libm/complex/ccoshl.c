@@ -36,11 +36,11 @@
 long double complex
 ccoshl(long double complex z)
 {
-    long double x, y;
+    long double ch, sh, s, c;
 
-    x = creall(z);
-    y = cimagl(z);
-    return CMPLXL(coshl(x) * cosl(y), sinhl(x) * sinl(y));
+    _cchshl(creall(z), &ch, &sh);
+    sincosl(cimagl(z), &s, &c);
+    return CMPLXL(ch * c, sh * s);
 }
 
 #endif
@@ -36,10 +36,11 @@
 long double complex
 ccosl(long double complex z)
 {
-    long double ch, sh;
+    long double ch, sh, s, c;
 
     _cchshl(cimagl(z), &ch, &sh);
-    return CMPLXL(cosl(creall(z)) * ch, -(sinl(creall(z)) * sh));
+    sincosl(creall(z), &s, &c);
+    return CMPLXL(c * ch, -(s * sh));
 }
 
 #endif
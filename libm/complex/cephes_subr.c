@@ -34,22 +34,36 @@
 
 #include "local-complex.h"
 
-/* calculate cosh and sinh */
+/*
+ * calculate cosh and sinh with a single exponential. Near zero, both
+ * come from t = e^|x| - 1, as cosh = 1 + u and sinh = t - u with
+ * u = t^2 / (2 (1 + t)), which avoids the cancellation in e - 1/e.
+ * Past the overflow threshold of exp, e^(|x|/2) is squared instead so
+ * that results just below the overflow threshold stay finite.
+ */
 
 void
 _cchsh(double x, double *c, double *s)
 {
-    double e, ei;
-
-    if (fabs(x) <= 0.5) {
-        *c = cosh(x);
-        *s = sinh(x);
-    } else {
+    double e, ei, t, u;
+
+    t = fabs(x);
+    if (t <= 0.5) {
+        t = expm1(t);
+        u = 0.5 * t * t / (1.0 + t);
+        *c = 1.0 + u;
+        *s = copysign(t - u, x);
+    } else if (t < 709.0) {
         e = exp(x);
         ei = 0.5 / e;
         e = 0.5 * e;
         *s = e - ei;
         *c = e + ei;
+    } else {
+        e = exp(0.5 * t);
+        e = (0.5 * e) * e;
+        *c = e;
+        *s = copysign(e, x);
     }
 }
 
@@ -59,7 +73,6 @@ _cchsh(double x, double *c, double *s)
 static const double DP1 = 3.14159265160560607910E0;
 static const double DP2 = 1.98418714791870343106E-9;
 static const double DP3 = 1.14423774522196636802E-17;
-#define MACHEP 1.1e-16
 
 double
 _redupi(double x)
@@ -78,47 +91,3 @@ _redupi(double x)
     t = ((x - t * DP1) - t * DP2) - t * DP3;
     return t;
 }
-
-/* Taylor series expansion for cosh(2y) - cos(2x) */
-
-double
-_ctans(double complex z)
-{
-    double f, x, x2, y, y2, rn, t;
-    double d;
-
-    x = fabs(2.0 * creal(z));
-    y = fabs(2.0 * cimag(z));
-
-    x = _redupi(x);
-
-    x = x * x;
-    y = y * y;
-    x2 = 1.0;
-    y2 = 1.0;
-    f = 1.0;
-    rn = 0.0;
-    d = 0.0;
-    do {
-        rn += 1.0;
-        f *= rn;
-        rn += 1.0;
-        f *= rn;
-        x2 *= x;
-        y2 *= y;
-        t = y2 + x2;
-        t /= f;
-        d += t;
-
-        rn += 1.0;
-        f *= rn;
-        rn += 1.0;
-        f *= rn;
-        x2 *= x;
-        y2 *= y;
-        t = y2 - x2;
-        t /= f;
-        d += t;
-    } while (fabs(t / d) > MACHEP);
-    return d;
-}
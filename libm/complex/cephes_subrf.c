@@ -34,22 +34,36 @@
 
 #include "local-complex.h"
 
-/* calculate cosh and sinh */
+/*
+ * calculate cosh and sinh with a single exponential. Near zero, both
+ * come from t = e^|x| - 1, as cosh = 1 + u and sinh = t - u with
+ * u = t^2 / (2 (1 + t)), which avoids the cancellation in e - 1/e.
+ * Past the overflow threshold of exp, e^(|x|/2) is squared instead so
+ * that results just below the overflow threshold stay finite.
+ */
 
 void
 _cchshf(float x, float *c, float *s)
 {
-    float e, ei;
-
-    if (fabsf(x) <= 0.5f) {
-        *c = coshf(x);
-        *s = sinhf(x);
-    } else {
+    float e, ei, t, u;
+
+    t = fabsf(x);
+    if (t <= 0.5f) {
+        t = expm1f(t);
+        u = 0.5f * t * t / (1.0f + t);
+        *c = 1.0f + u;
+        *s = copysignf(t - u, x);
+    } else if (t < 88.0f) {
         e = expf(x);
         ei = 0.5f / e;
         e = 0.5f * e;
         *s = e - ei;
         *c = e + ei;
+    } else {
+        e = expf(0.5f * t);
+        e = (0.5f * e) * e;
+        *c = e;
+        *s = copysignf(e, x);
     }
 }
 
@@ -59,7 +73,6 @@ _cchshf(float x, float *c, float *s)
 static const double DP1 = 3.140625;
 static const double DP2 = 9.67502593994140625E-4;
 static const double DP3 = 1.509957990978376432E-7;
-#define MACHEPF 3.0e-8f
 
 float
 _redupif(float x)
@@ -78,46 +91,3 @@ _redupif(float x)
     t = (((double)x - (double)t * DP1) - (double)t * DP2) - (double)t * DP3;
     return t;
 }
-
-/* Taylor series expansion for cosh(2y) - cos(2x) */
-
-float
-_ctansf(float complex z)
-{
-    float f, x, x2, y, y2, rn, t, d;
-
-    x = fabsf(2.0f * crealf(z));
-    y = fabsf(2.0f * cimagf(z));
-
-    x = _redupif(x);
-
-    x = x * x;
-    y = y * y;
-    x2 = 1.0f;
-    y2 = 1.0f;
-    f = 1.0f;
-    rn = 0.0f;
-    d = 0.0f;
-    do {
-        rn += 1.0f;
-        f *= rn;
-        rn += 1.0f;
-        f *= rn;
-        x2 *= x;
-        y2 *= y;
-        t = y2 + x2;
-        t /= f;
-        d += t;
-
-        rn += 1.0f;
-        f *= rn;
-        rn += 1.0f;
-        f *= rn;
-        x2 *= x;
-        y2 *= y;
-        t = y2 - x2;
-        t /= f;
-        d += t;
-    } while (fabsf(t / d) > MACHEPF);
-    return d;
-}
@@ -30,24 +30,39 @@
  */
 
 #include "local-complex.h"
+#include <float.h>
 
 #ifdef __HAVE_LONG_DOUBLE_MATH
-/* calculate cosh and sinh */
+/*
+ * calculate cosh and sinh with a single exponential. Near zero, both
+ * come from t = e^|x| - 1, as cosh = 1 + u and sinh = t - u with
+ * u = t^2 / (2 (1 + t)), which avoids the cancellation in e - 1/e.
+ * Past the overflow threshold of exp, e^(|x|/2) is squared instead so
+ * that results just below the overflow threshold stay finite.
+ */
 
 void
 _cchshl(long double x, long double *c, long double *s)
 {
-    long double e, ei;
-
-    if (fabsl(x) <= 0.5L) {
-        *c = coshl(x);
-        *s = sinhl(x);
-    } else {
+    long double e, ei, t, u;
+
+    t = fabsl(x);
+    if (t <= 0.5L) {
+        t = expm1l(t);
+        u = 0.5L * t * t / (1.0L + t);
+        *c = 1.0L + u;
+        *s = copysignl(t - u, x);
+    } else if (t < ((LDBL_MAX_EXP - 2) * 0.69314718L)) {
         e = expl(x);
         ei = 0.5L / e;
         e = 0.5L * e;
         *s = e - ei;
         *c = e + ei;
+    } else {
+        e = expl(0.5L * t);
+        e = (0.5L * e) * e;
+        *c = e;
+        *s = copysignl(e, x);
     }
 }
 
@@ -58,10 +73,8 @@ static const long double DP1 = 3.14159265358979323829596852490908531763125L;
 static const long double DP2 = 1.6667485837041756656403424829301998703007e-19L;
 #ifndef __vax__
 static const long double DP3 = 1.8830410776607851167459095484560349402753e-39L;
-#define MACHEPL 1.1e-38L
 #else
 static const long double DP3 = 0L;
-#define MACHEPL 1.1e-19L
 #endif
 
 long double
@@ -82,48 +95,4 @@ _redupil(long double x)
     return t;
 }
 
-/* Taylor series expansion for cosh(2y) - cos(2x) */
-
-long double
-_ctansl(long double complex z)
-{
-    long double f, x, x2, y, y2, rn, t;
-    long double d;
-
-    x = fabsl(2.0L * creall(z));
-    y = fabsl(2.0L * cimagl(z));
-
-    x = _redupil(x);
-
-    x = x * x;
-    y = y * y;
-    x2 = 1.0L;
-    y2 = 1.0L;
-    f = 1.0L;
-    rn = 0.0L;
-    d = 0.0L;
-    do {
-        rn += 1.0L;
-        f *= rn;
-        rn += 1.0L;
-        f *= rn;
-        x2 *= x;
-        y2 *= y;
-        t = y2 + x2;
-        t /= f;
-        d += t;
-
-        rn += 1.0L;
-        f *= rn;
-        rn += 1.0L;
-        f *= rn;
-        x2 *= x;
-        y2 *= y;
-        t = y2 - x2;
-        t /= f;
-        d += t;
-    } while (fabsl(t / d) > MACHEPL);
-    return d;
-}
-
 #endif
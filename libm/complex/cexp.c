@@ -69,10 +69,13 @@ QUICKREF
 double complex
 cexp(double complex z)
 {
-    double r, x, y;
+    double r, x, y, s, c;
 
     x = creal(z);
     y = cimag(z);
     r = exp(x);
-    return CMPLX(r * cos(y), r * sin(y));
+    if (y == 0.0)
+        return CMPLX(r, y);
+    sincos(y, &s, &c);
+    return CMPLX(r * c, r * s);
 }
@@ -37,10 +37,13 @@
 float complex
 cexpf(float complex z)
 {
-    float r, x, y;
+    float r, x, y, s, c;
 
     x = crealf(z);
     y = cimagf(z);
     r = expf(x);
-    return CMPLXF(r * cosf(y), r * sinf(y));
+    if (y == 0.0f)
+        return CMPLXF(r, y);
+    sincosf(y, &s, &c);
+    return CMPLXF(r * c, r * s);
 }
@@ -36,12 +36,15 @@
 long double complex
 cexpl(long double complex z)
 {
-    long double r, x, y;
+    long double r, x, y, s, c;
 
     x = creall(z);
     y = cimagl(z);
     r = expl(x);
-    return CMPLXL(r * cosl(y), r * sinl(y));
+    if (y == 0.0L)
+        return CMPLXL(r, y);
+    sincosl(y, &s, &c);
+    return CMPLXL(r * c, r * s);
 }
 
 #endif
@@ -30,16 +30,74 @@
  */
 
 #include "local-complex.h"
+#include <float.h>
 
 #ifdef __HAVE_LONG_DOUBLE_MATH
 
+#if LDBL_MANT_DIG == 64 || LDBL_MANT_DIG == 113
+
+/* x * x as hi + lo, using Dekker's exact product */
+static long double
+sqrl_exact(long double x, long double *lo)
+{
+    long double c = x * ((long double)(1ULL << ((LDBL_MANT_DIG + 1) / 2)) + 1);
+    long double xh = c - (c - x);
+    long double xl = x - xh;
+    long double hi = x * x;
+
+    *lo = ((xh * xh - hi) + 2 * xh * xl) + xl * xl;
+    return hi;
+}
+
+/*
+ * log|z|. Rounding |z| costs up to half an ulp of |z|, which is many
+ * ulps of log|z| when |z| is near one. Form x² + y² exactly as hi +
+ * lo and take half of its log instead.
+ */
+static long double
+clogl_real(long double x, long double y)
+{
+    long double t, hi, lo, ylo;
+
+    x = fabsl(x);
+    y = fabsl(y);
+    if (x < y) {
+        t = x;
+        x = y;
+        y = t;
+    }
+
+    /* Leave huge, tiny and special values to cabsl, where rounding
+       |z| is lost in the much larger log */
+    if (!isfinite(x) || isnan(y) || y == 0 || ilogbl(x) > LDBL_MAX_EXP / 2 - 2
+        || ilogbl(x) < LDBL_MIN_EXP / 2)
+        return logl(cabsl(CMPLXL(x, y)));
+
+    hi = sqrl_exact(x, &lo);
+    t = sqrl_exact(y, &ylo);
+    lo += ylo + ((hi - (hi + t)) + t);
+    hi += t;
+
+    t = hi + lo;
+    lo -= t - hi;
+    hi = t;
+
+    /* hi - 1 is exact here */
+    if (0.5L <= hi && hi <= 2.0L)
+        return 0.5L * log1pl((hi - 1) + lo);
+    return 0.5L * (logl(hi) + lo / hi);
+}
+
+#else
+#define clogl_real(x, y) logl(cabsl(CMPLXL(x, y)))
+#endif
+
 long double complex
 clogl(long double complex z)
 {
     long double p, rr;
 
-    rr = cabsl(z);
-    p = logl(rr);
+    p = clogl_real(creall(z), cimagl(z));
     rr = atan2l(cimagl(z), creall(z));
     return CMPLXL(p, rr);
 }
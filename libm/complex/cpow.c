@@ -75,6 +75,60 @@ QUICKREF
 
 #include "local-complex.h"
 
+#define CPOW_INT_MAX 64
+
+/*
+ * a^n for finite a and integral n with |n| <= CPOW_INT_MAX by
+ * repeated squaring, which is much faster than going through the
+ * polar form. The error grows with the number of steps, so n is
+ * capped where it is still no larger than in the polar form, whose
+ * angle n arg(a) carries n times the error of arg(a).
+ *
+ * a is scaled to have its larger part in [1, 2), which keeps the
+ * magnitude of every power within 2^±96 for such n, and the scale is
+ * applied to the result. That way overflow gives infinities rather
+ * than inf - inf. Negative powers form a^|n| and invert it once at
+ * the end, as in Smith's division.
+ */
+static double complex
+cpow_int(double complex a, int n)
+{
+    double   ar = creal(a), ai = cimag(a), pr = 1.0, pi = 0.0, t, d;
+    unsigned u = n < 0 ? -(unsigned)n : (unsigned)n;
+    int      k = ilogb(fmax(fabs(ar), fabs(ai)));
+
+    ar = scalbn(ar, -k);
+    ai = scalbn(ai, -k);
+
+    for (;;) {
+        if (u & 1) {
+            t = pr * ar - pi * ai;
+            pi = pr * ai + pi * ar;
+            pr = t;
+        }
+        u >>= 1;
+        if (!u)
+            break;
+        t = (ar - ai) * (ar + ai);
+        ai = 2.0 * ar * ai;
+        ar = t;
+    }
+    if (n < 0) {
+        if (fabs(pr) >= fabs(pi)) {
+            t = pi / pr;
+            d = pr + pi * t;
+            pr = 1.0 / d;
+            pi = -t / d;
+        } else {
+            t = pr / pi;
+            d = pi + pr * t;
+            pr = t / d;
+            pi = -1.0 / d;
+        }
+    }
+    return CMPLX(scalbn(pr, n * k), scalbn(pi, n * k));
+}
+
 double complex
 cpow(double complex a, double complex z)
 {
@@ -83,6 +137,10 @@ cpow(double complex a, double complex z)
 
     x = creal(z);
     y = cimag(z);
+    if (y == 0.0 && fabs(x) <= CPOW_INT_MAX && x == (int)x
+        && (creal(a) != 0.0 || cimag(a) != 0.0) && isfinite(creal(a))
+        && isfinite(cimag(a)))
+        return cpow_int(a, (int)x);
     absa = cabs(a);
     if (absa == 0.0) {
         return CMPLX(0, 0);
@@ -34,6 +34,60 @@
 
 #include "local-complex.h"
 
+#define CPOW_INT_MAX 64
+
+/*
+ * a^n for finite a and integral n with |n| <= CPOW_INT_MAX by
+ * repeated squaring, which is much faster than going through the
+ * polar form. The error grows with the number of steps, so n is
+ * capped where it is still no larger than in the polar form, whose
+ * angle n arg(a) carries n times the error of arg(a).
+ *
+ * a is scaled to have its larger part in [1, 2), which keeps the
+ * magnitude of every power within 2^±96 for such n, and the scale is
+ * applied to the result. That way overflow gives infinities rather
+ * than inf - inf. Negative powers form a^|n| and invert it once at
+ * the end, as in Smith's division.
+ */
+static float complex
+cpowf_int(float complex a, int n)
+{
+    float    ar = crealf(a), ai = cimagf(a), pr = 1.0f, pi = 0.0f, t, d;
+    unsigned u = n < 0 ? -(unsigned)n : (unsigned)n;
+    int      k = ilogbf(fmaxf(fabsf(ar), fabsf(ai)));
+
+    ar = scalbnf(ar, -k);
+    ai = scalbnf(ai, -k);
+
+    for (;;) {
+        if (u & 1) {
+            t = pr * ar - pi * ai;
+            pi = pr * ai + pi * ar;
+            pr = t;
+        }
+        u >>= 1;
+        if (!u)
+            break;
+        t = (ar - ai) * (ar + ai);
+        ai = 2.0f * ar * ai;
+        ar = t;
+    }
+    if (n < 0) {
+        if (fabsf(pr) >= fabsf(pi)) {
+            t = pi / pr;
+            d = pr + pi * t;
+            pr = 1.0f / d;
+            pi = -t / d;
+        } else {
+            t = pr / pi;
+            d = pi + pr * t;
+            pr = t / d;
+            pi = -1.0f / d;
+        }
+    }
+    return CMPLXF(scalbnf(pr, n * k), scalbnf(pi, n * k));
+}
+
 float complex
 cpowf(float complex a, float complex z)
 {
@@ -42,6 +96,10 @@ cpowf(float complex a, float complex z)
 
     x = crealf(z);
     y = cimagf(z);
+    if (y == 0.0f && fabsf(x) <= CPOW_INT_MAX && x == (int)x
+        && (crealf(a) != 0.0f || cimagf(a) != 0.0f) && isfinite(crealf(a))
+        && isfinite(cimagf(a)))
+        return cpowf_int(a, (int)x);
     absa = cabsf(a);
     if (absa == 0.0f) {
         return CMPLXF(0, 0);
@@ -31,8 +31,62 @@
 
 #include "local-complex.h"
 
+#define CPOW_INT_MAX 64
+
 #ifdef __HAVE_LONG_DOUBLE_MATH
 
+/*
+ * a^n for finite a and integral n with |n| <= CPOW_INT_MAX by
+ * repeated squaring, which is much faster than going through the
+ * polar form. The error grows with the number of steps, so n is
+ * capped where it is still no larger than in the polar form, whose
+ * angle n arg(a) carries n times the error of arg(a).
+ *
+ * a is scaled to have its larger part in [1, 2), which keeps the
+ * magnitude of every power within 2^±96 for such n, and the scale is
+ * applied to the result. That way overflow gives infinities rather
+ * than inf - inf. Negative powers form a^|n| and invert it once at
+ * the end, as in Smith's division.
+ */
+static long double complex
+cpowl_int(long double complex a, int n)
+{
+    long double ar = creall(a), ai = cimagl(a), pr = 1.0L, pi = 0.0L, t, d;
+    unsigned    u = n < 0 ? -(unsigned)n : (unsigned)n;
+    int         k = ilogbl(fmaxl(fabsl(ar), fabsl(ai)));
+
+    ar = scalbnl(ar, -k);
+    ai = scalbnl(ai, -k);
+
+    for (;;) {
+        if (u & 1) {
+            t = pr * ar - pi * ai;
+            pi = pr * ai + pi * ar;
+            pr = t;
+        }
+        u >>= 1;
+        if (!u)
+            break;
+        t = (ar - ai) * (ar + ai);
+        ai = 2.0L * ar * ai;
+        ar = t;
+    }
+    if (n < 0) {
+        if (fabsl(pr) >= fabsl(pi)) {
+            t = pi / pr;
+            d = pr + pi * t;
+            pr = 1.0L / d;
+            pi = -t / d;
+        } else {
+            t = pr / pi;
+            d = pi + pr * t;
+            pr = t / d;
+            pi = -1.0L / d;
+        }
+    }
+    return CMPLXL(scalbnl(pr, n * k), scalbnl(pi, n * k));
+}
+
 long double complex
 cpowl(long double complex a, long double complex z)
 {
@@ -41,6 +95,10 @@ cpowl(long double complex a, long double complex z)
 
     x = creall(z);
     y = cimagl(z);
+    if (y == 0.0L && fabsl(x) <= CPOW_INT_MAX && x == (int)x
+        && (creall(a) != 0.0L || cimagl(a) != 0.0L) && isfinite(creall(a))
+        && isfinite(cimagl(a)))
+        return cpowl_int(a, (int)x);
     absa = cabsl(a);
     if (absa == 0.0L) {
         return CMPLXL(0, 0);
@@ -69,8 +69,9 @@ QUICKREF
 double complex
 csin(double complex z)
 {
-    double ch, sh;
+    double ch, sh, s, c;
 
     _cchsh(cimag(z), &ch, &sh);
-    return CMPLX(sin(creal(z)) * ch, cos(creal(z)) * sh);
+    sincos(creal(z), &s, &c);
+    return CMPLX(s * ch, c * sh);
 }
@@ -37,8 +37,9 @@
 float complex
 csinf(float complex z)
 {
-    float ch, sh;
+    float ch, sh, s, c;
 
     _cchshf(cimagf(z), &ch, &sh);
-    return CMPLXF(sinf(crealf(z)) * ch, cosf(crealf(z)) * sh);
+    sincosf(crealf(z), &s, &c);
+    return CMPLXF(s * ch, c * sh);
 }
@@ -69,9 +69,9 @@ QUICKREF
 double complex
 csinh(double complex z)
 {
-    double x, y;
+    double ch, sh, s, c;
 
-    x = creal(z);
-    y = cimag(z);
-    return CMPLX(sinh(x) * cos(y), cosh(x) * sin(y));
+    _cchsh(creal(z), &ch, &sh);
+    sincos(cimag(z), &s, &c);
+    return CMPLX(sh * c, ch * s);
 }
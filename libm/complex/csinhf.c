@@ -37,9 +37,9 @@
 float complex
 csinhf(float complex z)
 {
-    float x, y;
+    float ch, sh, s, c;
 
-    x = crealf(z);
-    y = cimagf(z);
-    return CMPLXF(sinhf(x) * cosf(y), coshf(x) * sinf(y));
+    _cchshf(crealf(z), &ch, &sh);
+    sincosf(cimagf(z), &s, &c);
+    return CMPLXF(sh * c, ch * s);
 }
@@ -36,11 +36,11 @@
 long double complex
 csinhl(long double complex z)
 {
-    long double x, y;
+    long double ch, sh, s, c;
 
-    x = creall(z);
-    y = cimagl(z);
-    return CMPLXL(sinhl(x) * cosl(y), coshl(x) * sinl(y));
+    _cchshl(creall(z), &ch, &sh);
+    sincosl(cimagl(z), &s, &c);
+    return CMPLXL(sh * c, ch * s);
 }
 
 #endif
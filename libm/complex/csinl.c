@@ -36,10 +36,11 @@
 long double complex
 csinl(long double complex z)
 {
-    long double ch, sh;
+    long double ch, sh, s, c;
 
     _cchshl(cimagl(z), &ch, &sh);
-    return CMPLXL(sinl(creall(z)) * ch, cosl(creall(z)) * sh);
+    sincosl(creall(z), &s, &c);
+    return CMPLXL(s * ch, c * sh);
 }
 
 #endif
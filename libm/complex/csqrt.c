@@ -72,7 +72,7 @@ double complex
 csqrt(double complex z)
 {
     double complex w;
-    double         x, y, r, t, scale;
+    double         x, y, m, r, t, scale;
 
     x = creal(z);
     y = cimag(z);
@@ -100,24 +100,22 @@ csqrt(double complex z)
             w = CMPLX(r, -r);
         return w;
     }
-    /* Rescale to avoid internal overflow or underflow.  */
-    if ((fabs(x) > 4.0) || (fabs(y) > 4.0)) {
-        x *= 0.25;
-        y *= 0.25;
-        scale = 2.0;
+    /* Scale by even powers of two so that x^2 + y^2 can neither
+       overflow nor lose the smaller component to underflow; the
+       square root then halves the exponent exactly. */
+    m = fabs(x) > fabs(y) ? fabs(x) : fabs(y);
+    if (m > 0x1p500) {
+        x *= 0x1p-600;
+        y *= 0x1p-600;
+        scale = 0x1p300;
+    } else if (m < 0x1p-500) {
+        x *= 0x1p600;
+        y *= 0x1p600;
+        scale = 0x1p-300;
     } else {
-#if 1
-        x *= 1.8014398509481984e16; /* 2^54 */
-        y *= 1.8014398509481984e16;
-        scale = 7.450580596923828125e-9; /* 2^-27 */
-#else
-        x *= 4.0;
-        y *= 4.0;
-        scale = 0.5;
-#endif
+        scale = 1.0;
     }
-    w = CMPLX(x, y);
-    r = cabs(w);
+    r = sqrt(x * x + y * y);
     if (x > 0) {
         t = sqrt(0.5 * r + 0.5 * x);
         r = scale * fabs((0.5 * y) / t);
@@ -38,7 +38,8 @@ float complex
 csqrtf(float complex z)
 {
     float complex w;
-    float         x, y, r, t, scale;
+    float         x, y;
+    double        d, r, t;
 
     x = crealf(z);
     y = cimagf(z);
@@ -64,32 +65,14 @@ csqrtf(float complex z)
         return w;
     }
 
-    /* Rescale to avoid internal overflow or underflow.  */
-    if ((fabsf(x) > 4.0f) || (fabsf(y) > 4.0f)) {
-        x *= 0.25f;
-        y *= 0.25f;
-        scale = 2.0f;
-    } else {
-#if 1
-        x *= 6.7108864e7f; /* 2^26 */
-        y *= 6.7108864e7f;
-        scale = 1.220703125e-4f; /* 2^-13 */
-#else
-        x *= 4.0f;
-        y *= 4.0f;
-        scale = 0.5f;
-#endif
-    }
-    w = CMPLXF(x, y);
-    r = cabsf(w);
+    /* Work in double, where x^2 + y^2 is exact and in range */
+    d = sqrt((double)x * x + (double)y * y);
     if (x > 0) {
-        t = sqrtf(0.5f * r + 0.5f * x);
-        r = scale * fabsf((0.5f * y) / t);
-        t *= scale;
+        t = sqrt(0.5 * d + 0.5 * x);
+        r = fabs((0.5 * y) / t);
     } else {
-        r = sqrtf(0.5f * r - 0.5f * x);
-        t = scale * fabsf((0.5f * y) / r);
-        r *= scale;
+        r = sqrt(0.5 * d - 0.5 * x);
+        t = fabs((0.5 * y) / r);
     }
 
     if (y < 0)
@@ -27,7 +27,6 @@
 #define _GNU_SOURCE
 #include "local-complex.h"
 #include <float.h>
-#include <stdbool.h>
 
 #ifdef __HAVE_LONG_DOUBLE
 
@@ -40,16 +39,26 @@
  */
 // #pragma	STDC CX_LIMITED_RANGE	ON
 
-/* We risk spurious overflow for components >= LDBL_MAX / (1 + sqrt(2)). */
-#define THRESH (LDBL_MAX / 2.414213562373095048801688724209698L)
+/*
+ * Components beyond these bounds are scaled by an even power of two so
+ * that a^2 + b^2 can neither overflow nor lose the smaller component to
+ * underflow. The square root then halves the exponent exactly.
+ */
+#if LDBL_MAX_EXP > 1024
+#define SQRT_BIG   0x1p8000L
+#define SQRT_SMALL 0x1p-8000L
+#define SQRT_SHIFT 9000
+#else
+#define SQRT_BIG   0x1p500L
+#define SQRT_SMALL 0x1p-500L
+#define SQRT_SHIFT 600
+#endif
 
 long double complex
 csqrtl(long double complex z)
 {
-    long double complex result;
-    long double         a, b;
-    long double         t;
-    bool                scale;
+    long double a, b, m, h, t;
+    int         scale;
 
     a = creall(z);
     b = cimagl(z);
@@ -80,29 +89,38 @@ csqrtl(long double complex z)
      * the normal code path below.
      */
 
-    /* Scale to avoid overflow. */
-    if (fabsl(a) >= THRESH || fabsl(b) >= THRESH) {
-        a *= 0.25L;
-        b *= 0.25L;
-        scale = true;
+    /* Scale to avoid overflow and underflow. */
+    m = fabsl(a) > fabsl(b) ? fabsl(a) : fabsl(b);
+    if (m > SQRT_BIG) {
+        a = ldexpl(a, -SQRT_SHIFT);
+        b = ldexpl(b, -SQRT_SHIFT);
+        scale = SQRT_SHIFT / 2;
+    } else if (m < SQRT_SMALL) {
+        a = ldexpl(a, SQRT_SHIFT);
+        b = ldexpl(b, SQRT_SHIFT);
+        scale = -SQRT_SHIFT / 2;
     } else {
-        scale = false;
+        scale = 0;
     }
+    h = sqrtl(a * a + b * b);
 
     /* Algorithm 312, CACM vol 10, Oct 1967. */
     if (a >= 0L) {
-        t = sqrtl((a + hypotl(a, b)) * 0.5L);
-        result = CMPLXL(t, b / (2.0L * t));
+        t = sqrtl((a + h) * 0.5L);
+        a = t;
+        b = b / (2.0L * t);
     } else {
-        t = sqrtl((-a + hypotl(a, b)) * 0.5L);
-        result = CMPLXL(fabsl(b) / (2.0L * t), copysignl(t, b));
+        t = sqrtl((-a + h) * 0.5L);
+        a = fabsl(b) / (2.0L * t);
+        b = copysignl(t, b);
     }
 
     /* Rescale. */
-    if (scale)
-        return (result * 2.0L);
-    else
-        return (result);
+    if (scale) {
+        a = ldexpl(a, scale);
+        b = ldexpl(b, scale);
+    }
+    return CMPLXL(a, b);
 }
 
 #endif /* __HAVE_LONG_DOUBLE */
@@ -66,20 +66,25 @@ QUICKREF
 
 #include "local-complex.h"
 
+/*
+ * tan(x + iy) = (sin x cos x + i sinh y cosh y) / (cos^2 x + sinh^2 y)
+ *
+ * The denominator is a sum of squares, so unlike cos 2x + cosh 2y it
+ * never cancels and needs no series near the poles. Once sinh^2 y
+ * swamps cos^2 x, the imaginary part is +-1 and the real part is
+ * 4 sin x cos x e^-2|y|.
+ */
 double complex
 ctan(double complex z)
 {
-    double d;
-
-    d = cos(2.0 * creal(z)) + cosh(2.0 * cimag(z));
-
-    if (fabs(d) < 0.25)
-        d = _ctans(z);
-
-    if (d == 0.0) {
-        /* mtherr ("ctan", OVERFLOW); */
-        return CMPLX(HUGE_VAL, HUGE_VAL);
-    }
-
-    return CMPLX(sin(2.0 * creal(z)) / d, sinh(2.0 * cimag(z)) / d);
+    double x, y, s, c, ch, sh, d;
+
+    x = creal(z);
+    y = cimag(z);
+    sincos(x, &s, &c);
+    if (fabs(y) > 20.0)
+        return CMPLX(4.0 * s * c * exp(-2 * fabs(y)), copysign(1.0, y));
+    _cchsh(y, &ch, &sh);
+    d = c * c + sh * sh;
+    return CMPLX(s * c / d, sh * ch / d);
 }
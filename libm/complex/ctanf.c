@@ -34,20 +34,25 @@
 
 #include "local-complex.h"
 
+/*
+ * tan(x + iy) = (sin x cos x + i sinh y cosh y) / (cos^2 x + sinh^2 y)
+ *
+ * The denominator is a sum of squares, so unlike cos 2x + cosh 2y it
+ * never cancels and needs no series near the poles. Once sinh^2 y
+ * swamps cos^2 x, the imaginary part is +-1 and the real part is
+ * 4 sin x cos x e^-2|y|.
+ */
 float complex
 ctanf(float complex z)
 {
-    float d;
-
-    d = cosf(2.0f * crealf(z)) + coshf(2.0f * cimagf(z));
-
-    if (fabsf(d) < 0.25f)
-        d = _ctansf(z);
-
-    if (d == 0.0f) {
-        /* mtherr ("ctan", OVERFLOW); */
-        return CMPLXF(HUGE_VALF, HUGE_VALF);
-    }
+    float x, y, s, c, ch, sh, d;
 
-    return CMPLXF(sinf(2.0f * crealf(z)) / d, sinhf(2.0f * cimagf(z)) / d);
+    x = crealf(z);
+    y = cimagf(z);
+    sincosf(x, &s, &c);
+    if (fabsf(y) > 10.0f)
+        return CMPLXF(4.0f * s * c * expf(-2 * fabsf(y)), copysignf(1.0f, y));
+    _cchshf(y, &ch, &sh);
+    d = c * c + sh * sh;
+    return CMPLXF(s * c / d, sh * ch / d);
 }
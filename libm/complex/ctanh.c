@@ -66,13 +66,18 @@ QUICKREF
 
 #include "local-complex.h"
 
+/* tanh(z) = -i tan(iz), computed the same way as ctan */
 double complex
 ctanh(double complex z)
 {
-    double x, y, d;
+    double x, y, s, c, ch, sh, d;
 
     x = creal(z);
     y = cimag(z);
-    d = cosh(2.0 * x) + cos(2.0 * y);
-    return CMPLX(sinh(2.0 * x) / d, sin(2.0 * y) / d);
+    sincos(y, &s, &c);
+    if (fabs(x) > 20.0)
+        return CMPLX(copysign(1.0, x), 4.0 * s * c * exp(-2 * fabs(x)));
+    _cchsh(x, &ch, &sh);
+    d = c * c + sh * sh;
+    return CMPLX(sh * ch / d, s * c / d);
 }
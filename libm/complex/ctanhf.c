@@ -34,13 +34,18 @@
 
 #include "local-complex.h"
 
+/* tanh(z) = -i tan(iz), computed the same way as ctanf */
 float complex
 ctanhf(float complex z)
 {
-    float x, y, d;
+    float x, y, s, c, ch, sh, d;
 
     x = crealf(z);
     y = cimagf(z);
-    d = coshf(2.0f * x) + cosf(2.0f * y);
-    return CMPLXF(sinhf(2.0f * x) / d, sinf(2.0f * y) / d);
+    sincosf(y, &s, &c);
+    if (fabsf(x) > 10.0f)
+        return CMPLXF(copysignf(1.0f, x), 4.0f * s * c * expf(-2 * fabsf(x)));
+    _cchshf(x, &ch, &sh);
+    d = c * c + sh * sh;
+    return CMPLXF(sh * ch / d, s * c / d);
 }
@@ -33,15 +33,20 @@
 
 #ifdef __HAVE_LONG_DOUBLE_MATH
 
+/* tanh(z) = -i tan(iz), computed the same way as ctanl */
 long double complex
 ctanhl(long double complex z)
 {
-    long double x, y, d;
+    long double x, y, s, c, ch, sh, d;
 
     x = creall(z);
     y = cimagl(z);
-    d = coshl(2.0L * x) + cosl(2.0L * y);
-    return CMPLXL(sinhl(2.0L * x) / d, sinl(2.0L * y) / d);
+    sincosl(y, &s, &c);
+    if (fabsl(x) > 40.0L)
+        return CMPLXL(copysignl(1.0L, x), 4.0L * s * c * expl(-2 * fabsl(x)));
+    _cchshl(x, &ch, &sh);
+    d = c * c + sh * sh;
+    return CMPLXL(sh * ch / d, s * c / d);
 }
 
 #endif
@@ -33,22 +33,27 @@
 
 #ifdef __HAVE_LONG_DOUBLE_MATH
 
+/*
+ * tan(x + iy) = (sin x cos x + i sinh y cosh y) / (cos^2 x + sinh^2 y)
+ *
+ * The denominator is a sum of squares, so unlike cos 2x + cosh 2y it
+ * never cancels and needs no series near the poles. Once sinh^2 y
+ * swamps cos^2 x, the imaginary part is +-1 and the real part is
+ * 4 sin x cos x e^-2|y|.
+ */
 long double complex
 ctanl(long double complex z)
 {
-    long double d;
-
-    d = cosl(2.0L * creall(z)) + coshl(2.0L * cimagl(z));
-
-    if (fabsl(d) < 0.25L)
-        d = _ctansl(z);
-
-    if (d == 0.0L) {
-        /* mtherr ("ctan", OVERFLOW); */
-        return CMPLXL(HUGE_VALL, HUGE_VALL);
-    }
-
-    return CMPLXL(sinl(2.0L * creall(z)) / d, sinhl(2.0L * cimagl(z)) / d);
+    long double x, y, s, c, ch, sh, d;
+
+    x = creall(z);
+    y = cimagl(z);
+    sincosl(x, &s, &c);
+    if (fabsl(y) > 40.0L)
+        return CMPLXL(4.0L * s * c * expl(-2 * fabsl(y)), copysignl(1.0L, y));
+    _cchshl(y, &ch, &sh);
+    d = c * c + sh * sh;
+    return CMPLXL(s * c / d, sh * ch / d);
 }
 
 #endif
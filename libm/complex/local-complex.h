@@ -36,7 +36,7 @@
 #ifndef _LOCAL_COMPLEX_H_
 #define _LOCAL_COMPLEX_H_
 
-#define _DEFAULT_SOURCE
+#define _GNU_SOURCE
 
 #include <complex.h>
 #include <math.h>
@@ -51,18 +51,15 @@
 
 void  _cchshf(float, float *, float *);
 float _redupif(float);
-float _ctansf(float complex);
 
 #define M_PIF   ((float)M_PI)
 #define M_PI_2F ((float)M_PI_2)
 
 void        _cchsh(double, double *, double *);
 double      _redupi(double);
-double      _ctans(double complex);
 
 void        _cchshl(long double, long double *, long double *);
 long double _redupil(long double);
-long double _ctansl(long double complex);
 
 #define M_PIL   3.14159265358979323846264338327950280e+00L
 #define M_PI_2L 1.57079632679489661923132169163975140e+00L
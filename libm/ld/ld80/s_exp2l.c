@@ -37,8 +37,11 @@ static const long double twom10000 = 0x1p-10000L;
 static const volatile long double twom10000 = 0x1p-10000L;
 #endif
 
-static const double redux = 0x1.8p63 / TBLSIZE, P1 = 0x1.62e42fefa39efp-1,
-                    P2 = 0x1.ebfbdff82c58fp-3, P3 = 0x1.c6b08d7049fap-5, P4 = 0x1.3b2ab6fba4da5p-7,
+/* P1 needs the full long double precision of ln(2) */
+static const long double P1 = 0x1.62e42fefa39ef358p-1L;
+
+static const double redux = 0x1.8p63 / TBLSIZE, P2 = 0x1.ebfbdff82c58fp-3,
+                    P3 = 0x1.c6b08d7049fap-5, P4 = 0x1.3b2ab6fba4da5p-7,
                     P5 = 0x1.5d8804780a736p-10, P6 = 0x1.430918835e33dp-13;
 
 static const double tbl[TBLSIZE * 2] = {
@@ -320,34 +323,19 @@ static const double tbl[TBLSIZE * 2] = {
  *   degree-6 minimax polynomial with maximum error under 2**-69.
  *   The table entries each have 104 bits of accuracy, encoded as
  *   a pair of double precision values.
+ *
+ * The kernel evaluates 2**(x + xlo) for |x| < 16446 and |xlo| < 2**-16,
+ * where xlo carries bits of the argument beyond long double precision
+ * and is simply added to z.
  */
-long double
-exp2l(long double x)
+static inline long double
+exp2l_kernel(long double x, long double xlo)
 {
     union IEEEl2bits u, v;
     long double      r, twopk, twopkp10000, z;
-    uint32_t         hx, ix, i0;
+    uint32_t         i0;
     int              k;
 
-    /* Filter out exceptional cases. */
-    u.e = x;
-    hx = u.xbits.expsign;
-    ix = hx & EXPMASK;
-    if (ix >= BIAS + 14) { /* |x| >= 16384 or x is NaN */
-        if (ix == BIAS + LDBL_MAX_EXP) {
-            if (u.xbits.man != (unsigned long long)LDBL_NBIT_INF << 32 || (hx & 0x8000) == 0)
-                return (x + x); /* x is +Inf or NaN */
-            else
-                return (0.0l); /* x is -Inf */
-        }
-        if (x >= 16384)
-            return __math_oflowl(0); /* overflow */
-        if (x <= -16446)
-            return __math_uflowl(0); /* underflow */
-    } else if (ix <= BIAS - 66) {    /* |x| < 0x1p-66 */
-        return (1.0l + x);
-    }
-
     /*
      * Reduce x, computing z, i0, and k. The low bits of x + redux
      * contain the 16-bit integer part of the exponent (k) followed by
@@ -367,7 +355,7 @@ exp2l(long double x)
     k = (int)i0 >> TBLBITS;
     i0 = (i0 & (TBLSIZE - 1)) << 1;
     u.e -= (long double)redux;
-    z = x - u.e;
+    z = (x - u.e) + xlo;
     v.xbits.man = 1ULL << 63;
     if (k >= LDBL_MIN_EXP) {
         v.xbits.expsign = LDBL_MAX_EXP - 1 + k;
@@ -383,7 +371,7 @@ exp2l(long double x)
     /* XXX This gives > 1 ulp errors outside of FE_TONEAREST mode */
     r = t_lo
         + (t_hi + t_lo) * z
-            * ((long double)P1
+            * (P1
                + z
                    * ((long double)P2
                       + z
@@ -402,3 +390,38 @@ exp2l(long double x)
         return (r * twopkp10000 * twom10000);
     }
 }
+
+/* Out of line version of the kernel for expl and powl */
+long double
+__kernel_exp2l(long double x, long double xlo)
+{
+    return exp2l_kernel(x, xlo);
+}
+
+long double
+exp2l(long double x)
+{
+    union IEEEl2bits u;
+    uint32_t         hx, ix;
+
+    /* Filter out exceptional cases. */
+    u.e = x;
+    hx = u.xbits.expsign;
+    ix = hx & EXPMASK;
+    if (ix >= BIAS + 14) { /* |x| >= 16384 or x is NaN */
+        if (ix == BIAS + LDBL_MAX_EXP) {
+            if (u.xbits.man != (unsigned long long)LDBL_NBIT_INF << 32 || (hx & 0x8000) == 0)
+                return (x + x); /* x is +Inf or NaN */
+            else
+                return (0.0l); /* x is -Inf */
+        }
+        if (x >= 16384)
+            return __math_oflowl(0); /* overflow */
+        if (x <= -16446)
+            return __math_uflowl(0); /* underflow */
+    } else if (ix <= BIAS - 66) {    /* |x| < 0x1p-66 */
+        return (1.0l + x);
+    }
+
+    return exp2l_kernel(x, 0.0L);
+}
@@ -53,6 +53,7 @@ int         __kernel_rem_pio2(double *, double *, int, int, int);
 long double __kernel_sinl(long double, long double, int);
 long double __kernel_cosl(long double, long double);
 long double __kernel_tanl(long double, long double, int);
+long double __kernel_exp2l(long double, long double);
 
 #ifndef __FreeBSD__
 #define STRICT_ASSIGN(type, lval, rval) ((lval) = (rval))
@@ -0,0 +1,78 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent <agent@local>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <float.h>
+
+#if !defined(_SOFT_FLOAT) && LDBL_MANT_DIG == 64
+
+#include "x87_math.h"
+
+/* ln(2) as hi + lo, with hi also split into two 32-bit halves */
+static const long double LN2 = 0x1.62e42fefa39ef358p-1L;
+static const double      LN2_LO = -0x1.b0e2633fe0685p-67;
+static const long double LN2_H = 0x1.62e42ffp-1L;
+static const long double LN2_L = -0x1.718432ap-35L;
+
+/*
+ * log(x) = log2(x) ln(2), with log2(x) as hi + lo from the log2l
+ * kernel and the product with ln(2) formed exactly, so the only
+ * significant error is the final rounding.
+ */
+long double
+logl(long double x)
+{
+    long double hi, lo, hh, hl, p;
+
+    if (isnan(x))
+        return x + x;
+    if (x <= 0.0L) {
+        if (x == 0.0L)
+            return __math_divzerol(1);
+        return __math_invalidl(x);
+    }
+    if (isinf(x))
+        return x;
+    if (x == 1.0L)
+        return 0.0L;
+    hi = __kernel_log2l(x, &lo);
+    hh = x87_split(hi, &hl);
+    p = hi * LN2;
+    return p + ((((hh * LN2_H - p) + hh * LN2_L + hl * LN2_H) + hl * LN2_L)
+                + (hi * LN2_LO + lo * LN2));
+}
+
+#else
+#include "../../ld/e_logl.c"
+#endif
@@ -0,0 +1,125 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent <agent@local>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <float.h>
+
+#if !defined(_SOFT_FLOAT) && LDBL_MANT_DIG == 64
+
+#include "x87_math.h"
+
+/* 0 if y is not an integer, 1 if it is odd and 2 if it is even */
+static int
+yint(long double y)
+{
+    long double h = 0.5L * y;
+
+    if (x87_frndint(y) != y)
+        return 0;
+    return x87_frndint(h) != h ? 1 : 2;
+}
+
+/*
+ * x^y = 2^(y log2(x)). log2(x) comes from the log2l kernel as hi + lo
+ * with about 70 bits of precision, the product with y is formed
+ * exactly with Dekker's method and the result goes to the exp2l
+ * kernel as a two-part argument.
+ */
+long double
+powl(long double x, long double y)
+{
+    long double l, ll, yh, yl, lh, lt, p, lo, r;
+    int         sign = 0;
+
+    if (y == 0.0L)
+        return issignalingl_inline(x) ? x + y : 1.0L;
+    if (x == 1.0L)
+        return issignalingl_inline(y) ? x + y : 1.0L;
+    if (isnan(x) || isnan(y))
+        return x + y;
+    if (isinf(y)) {
+        long double ax = fabsl(x);
+        if (ax == 1.0L)
+            return 1.0L;
+        return (ax < 1.0L) == (y < 0.0L) ? y * y : 0.0L;
+    }
+    if (signbit(x)) {
+        int yi = yint(y);
+        if (yi == 0) {
+            if (x == 0.0L || isinf(x))
+                yi = 2;
+            else
+                return __math_invalidl(x);
+        }
+        sign = yi == 1;
+        x = -x;
+    }
+    if (x == 1.0L)
+        return sign ? -1.0L : 1.0L;
+    if (x == 0.0L) {
+        if (y < 0.0L)
+            return __math_divzerol(sign);
+        return sign ? -0.0L : 0.0L;
+    }
+    if (isinf(x)) {
+        r = y < 0.0L ? 0.0L : x;
+        return sign ? -r : r;
+    }
+
+    l = __kernel_log2l(x, &ll);
+    /* Past this, y log2(x) is out of range for any x != 1 */
+    if (fabsl(y) >= 0x1p16000L)
+        return (l > 0.0L) == (y > 0.0L) ? __math_oflowl(sign) : __math_uflowl(sign);
+    p = y * l;
+    if (p >= 16384.0L)
+        return __math_oflowl(sign);
+    if (p <= -16446.0L)
+        return __math_uflowl(sign);
+    yh = x87_split(y, &yl);
+    lh = x87_split(l, &lt);
+    lo = (((yh * lh - p) + yh * lt + yl * lh) + yl * lt) + y * ll;
+    r = check_uflowl(check_oflowl(__kernel_exp2l(p, lo)));
+    return sign ? -r : r;
+}
+
+#ifdef __strong_reference
+#if defined(__GNUCLIKE_PRAGMA_DIAGNOSTIC) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmissing-attributes"
+#endif
+__strong_reference(powl, _powl);
+#endif
+
+#else
+#include "../../ld/e_powl.c"
+#endif
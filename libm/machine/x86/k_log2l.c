@@ -0,0 +1,258 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent <agent@local>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <float.h>
+
+#if !defined(_SOFT_FLOAT) && LDBL_MANT_DIG == 64
+
+#include "x87_math.h"
+
+/*
+ * 1/c and -log2(c) for 128 subintervals of [1, 2), with the upper
+ * part of the range folded down to [sqrt(1/2), 1) so that c stays
+ * close to 1/m. c has 9 significant bits, which keeps products with
+ * half of a split long double exact. The intervals on either side of
+ * 1 use c = 1 so that log2(x) retains its relative accuracy as x
+ * approaches 1.
+ */
+static const struct {
+    long double logc;
+    double      logclo;
+    float       invc;
+} log2l_tab[128] = {
+    { 0x0p+0L, 0x0p+0, 0x1p+0f },
+    { 0x1.16a21e20a0a450bcp-6L, 0x1.268271cbde0f5p-71, 0x1.fap-1f },
+    { 0x1.d23afc49139f89bcp-6L, 0x1.b5cf7a8250a9fp-71, 0x1.f6p-1f },
+    { 0x1.47aa07357704f2b4p-5L, 0x1.4731889ee24cp-70, 0x1.f2p-1f },
+    { 0x1.8f135b81079119d4p-5L, 0x1.0666b59b5181bp-74, 0x1.efp-1f },
+    { 0x1.eef792508b69d614p-5L, -0x1.19b48c9c42d2bp-70, 0x1.ebp-1f },
+    { 0x1.27d24bae824dac2p-4L, 0x1.43f6d5d04a92p-73, 0x1.e7p-1f },
+    { 0x1.4c560fe68af880ep-4L, 0x1.41e66faaaaca5p-69, 0x1.e4p-1f },
+    { 0x1.7d60496cfbb4c674p-4L, -0x1.2ebb81cf52c6cp-70, 0x1.ep-1f },
+    { 0x1.a26ccd998185289ap-4L, -0x1.7b0453d26c08bp-69, 0x1.ddp-1f },
+    { 0x1.d4300a2524d4176cp-4L, -0x1.968946efbe623p-69, 0x1.d9p-1f },
+    { 0x1.f9c95dc1d1164e94p-4L, -0x1.a9a55c745ecdcp-69, 0x1.d6p-1f },
+    { 0x1.162593186da6fc42p-3L, -0x1.fb7852ba32833p-71, 0x1.d2p-1f },
+    { 0x1.293ac3dc1a66865ep-3L, 0x1.619fe2f08a6e4p-69, 0x1.cfp-1f },
+    { 0x1.3c6fb650cde50a16p-3L, 0x1.12b1e4f6ca31p-69, 0x1.ccp-1f },
+    { 0x1.4fc4d4d9bb3135fp-3L, 0x1.618b95c357be8p-68, 0x1.c9p-1f },
+    { 0x1.633a8bf437ce10aap-3L, 0x1.f5c011f76b2ebp-69, 0x1.c6p-1f },
+    { 0x1.7d60496cfbb4c674p-3L, -0x1.2ebb81cf52c6cp-69, 0x1.c2p-1f },
+    { 0x1.9123c1528c6cdef4p-3L, 0x1.b19bcc25995cbp-68, 0x1.bfp-1f },
+    { 0x1.a5094b54d2828404p-3L, 0x1.db75675c907e9p-68, 0x1.bcp-1f },
+    { 0x1.b9115db83a3dd2d4p-3L, -0x1.5a82b5c34e2acp-68, 0x1.b9p-1f },
+    { 0x1.cd3c712d31109326p-3L, -0x1.150bf6337797p-70, 0x1.b6p-1f },
+    { 0x1.e18b00e13123d066p-3L, 0x1.fbaf846fc7d7ep-68, 0x1.b3p-1f },
+    { 0x1.ef28aacd7223120cp-3L, 0x1.89f3ce78ee1a8p-69, 0x1.b1p-1f },
+    { 0x1.01d9bbcfa61d45dap-2L, 0x1.32880194144bp-69, 0x1.aep-1f },
+    { 0x1.0c318aedff3c0766p-2L, 0x1.b6125b9d35424p-68, 0x1.abp-1f },
+    { 0x1.169c05363f158724p-2L, -0x1.5e0ff45432475p-67, 0x1.a8p-1f },
+    { 0x1.21196e87473d0b3p-2L, -0x1.fc3cc8e50f686p-67, 0x1.a5p-1f },
+    { 0x1.28225bb5e64a3e8ep-2L, 0x1.5617ef45f78e1p-67, 0x1.a3p-1f },
+    { 0x1.32bfee370ee6865ap-2L, 0x1.24bc6f1acf95ep-69, 0x1.ap-1f },
+    { 0x1.3d712bf9c9deecc6p-2L, 0x1.1b9141c5d31aep-69, 0x1.9dp-1f },
+    { 0x1.449d115ef7d876c8p-2L, -0x1.23d5b57ba2f51p-68, 0x1.9bp-1f },
+    { 0x1.4f6fbb2cec59878ep-2L, 0x1.3a16b94b51cf7p-68, 0x1.98p-1f },
+    { 0x1.56b22e6b578e49cap-2L, -0x1.94c755768743ep-70, 0x1.96p-1f },
+    { 0x1.61a717cac1983116p-2L, -0x1.fc2e0412a532cp-71, 0x1.93p-1f },
+    { 0x1.6900a8836d0d5074p-2L, 0x1.e6bca777045b2p-67, 0x1.91p-1f },
+    { 0x1.7418acebbf18eb66p-2L, -0x1.fff8099cbaaa1p-67, 0x1.8ep-1f },
+    { 0x1.7b89f02cf2aad32p-2L, -0x1.d87452ab13619p-67, 0x1.8cp-1f },
+    { 0x1.8304d90c11fd32a4p-2L, -0x1.53d6d2a96369bp-68, 0x1.8ap-1f },
+    { 0x1.8e4f83fa145edafcp-2L, 0x1.078f461d45ccdp-67, 0x1.87p-1f },
+    { 0x1.95e2f9b51f04e2f2p-2L, 0x1.9b3611ce567bbp-68, 0x1.85p-1f },
+    { 0x1.9d806ebc9921b8c2p-2L, -0x1.1d2080a35b596p-68, 0x1.83p-1f },
+    { 0x1.a8ff971810a5e182p-2L, -0x1.00589050345d7p-67, 0x1.8p-1f },
+    { 0x1.b0b67f4f4680ff5p-2L, 0x1.ec47c71458314p-67, 0x1.7ep-1f },
+    { 0x1.b877c57b1b06fefep-2L, 0x1.339e5677ec44ep-69, 0x1.7cp-1f },
+    { 0x1.c043859e2fdb37b8p-2L, -0x1.5d473844f1163p-69, 0x1.7ap-1f },
+    { 0x1.c819dc2d45fe438ap-2L, -0x1.44ea773361b8p-67, 0x1.78p-1f },
+    { 0x1.d3ef776d43ff3f0ep-2L, 0x1.4c8700a63457dp-67, 0x1.75p-1f },
+    { 0x1.dbe0c58c3cff1a56p-2L, 0x1.4ba7ee8b2e8b7p-67, 0x1.73p-1f },
+    { 0x1.e3dd1156507ddd8ap-2L, 0x1.5435db02db327p-69, 0x1.71p-1f },
+    { 0x1.ebe47960e3c087fep-2L, 0x1.3949a1897d69ap-68, 0x1.6fp-1f },
+    { 0x1.f3f71cc1b629b82cp-2L, 0x1.b83831a00f6f2p-67, 0x1.6dp-1f },
+    { 0x1.fc151b11b36401bap-2L, -0x1.5fbde8cb1355bp-68, 0x1.6bp-1f },
+    { -0x1.fbc16b902680a23ap-2L, -0x1.1b3314f09de6cp-67, 0x1.69p+0f },
+    { -0x1.f38c567bcc540d1p-2L, 0x1.c82d2f412a41fp-70, 0x1.67p+0f },
+    { -0x1.eb4b847d15bce53ep-2L, -0x1.727980f5ec8b1p-68, 0x1.65p+0f },
+    { -0x1.e2fed3d0972980ep-2L, 0x1.bb5518bbd54a3p-67, 0x1.63p+0f },
+    { -0x1.daa6222064fb9012p-2L, -0x1.d295c55846dbap-68, 0x1.61p+0f },
+    { -0x1.d2414c80bf27d522p-2L, 0x1.48256ad616cd3p-67, 0x1.5fp+0f },
+    { -0x1.ce0a4923a587cc96p-2L, 0x1.7ae88c2fd36fbp-69, 0x1.5ep+0f },
+    { -0x1.c592fad295b567e8p-2L, 0x1.1ab5110ccf3acp-70, 0x1.5cp+0f },
+    { -0x1.bd0f2e9e79030ab4p-2L, -0x1.0b38c8045b0a3p-68, 0x1.5ap+0f },
+    { -0x1.b47ebf73882a0a42p-2L, 0x1.7220e04ebb0e3p-67, 0x1.58p+0f },
+    { -0x1.abe18797f1f48e1ap-2L, -0x1.1c9556316f5c8p-68, 0x1.56p+0f },
+    { -0x1.a33760a7f60509d8p-2L, 0x1.df9434309d27p-69, 0x1.54p+0f },
+    { -0x1.9edd6759b25df88ep-2L, 0x1.38c18e544d1a2p-68, 0x1.53p+0f },
+    { -0x1.961f90527409b8dp-2L, 0x1.4c50a47364d58p-67, 0x1.51p+0f },
+    { -0x1.8d54673b5c371ab4p-2L, 0x1.7b6d292603e45p-69, 0x1.4fp+0f },
+    { -0x1.88e9c72e0b225a4cp-2L, 0x1.336b66e4ac8aap-67, 0x1.4ep+0f },
+    { -0x1.800a563161c5432ap-2L, -0x1.d6c13e9bef591p-67, 0x1.4cp+0f },
+    { -0x1.771d2ba7efb3be46p-2L, -0x1.fd9aa24494ff9p-67, 0x1.4ap+0f },
+    { -0x1.72a1637cbc182944p-2L, 0x1.64cd6babff1abp-67, 0x1.49p+0f },
+    { -0x1.699f5248cd4b868cp-2L, -0x1.52150d2dbedf1p-68, 0x1.47p+0f },
+    { -0x1.608f1b42948ad97p-2L, 0x1.fe315bf347eeap-67, 0x1.45p+0f },
+    { -0x1.5c01a39fbd6879fap-2L, -0x1.624140d175ba2p-75, 0x1.44p+0f },
+    { -0x1.52dbdfc4c96b37dcp-2L, -0x1.ec1cc3f936a59p-67, 0x1.42p+0f },
+    { -0x1.49a784bcd1b8afe4p-2L, -0x1.257edfe9b5fb7p-67, 0x1.4p+0f },
+    { -0x1.4507cfedd4fc394ep-2L, 0x1.4bec0067239e1p-67, 0x1.3fp+0f },
+    { -0x1.3bbd3a0a1dcfa958p-2L, -0x1.86e86d31a4eap-69, 0x1.3dp+0f },
+    { -0x1.37124cea4cdecd9ap-2L, 0x1.d9926d3f02374p-67, 0x1.3cp+0f },
+    { -0x1.2db10fc4d9aaf6f2p-2L, 0x1.90b84e7218647p-67, 0x1.3ap+0f },
+    { -0x1.28fab35b3268363p-2L, -0x1.d0b52117cb07ep-69, 0x1.39p+0f },
+    { -0x1.1f825f6d88e132bep-2L, -0x1.0d1a7ef9ba62p-67, 0x1.37p+0f },
+    { -0x1.1ac05b291f070528p-2L, -0x1.8e70dbf194341p-67, 0x1.36p+0f },
+    { -0x1.11307dad30b75cbp-2L, -0x1.2e0b4f2b49d4p-67, 0x1.34p+0f },
+    { -0x1.0c62975542a8ea5p-2L, 0x1.3816f9f47fc2cp-68, 0x1.33p+0f },
+    { -0x1.0790adbb030096fp-2L, -0x1.8d34ceaa2dd6dp-69, 0x1.32p+0f },
+    { -0x1.fbc16b902680a23ap-3L, -0x1.1b3314f09de6cp-68, 0x1.3p+0f },
+    { -0x1.f205339208f27478p-3L, 0x1.5ab319ce62b61p-68, 0x1.2fp+0f },
+    { -0x1.de73fe3b1480ee1cp-3L, 0x1.bd8c32e1be0e8p-71, 0x1.2dp+0f },
+    { -0x1.d49ee4c32596fc9p-3L, 0x1.69535fb8bf578p-68, 0x1.2cp+0f },
+    { -0x1.cac163c770dc896cp-3L, -0x1.32962c478e4b8p-69, 0x1.2bp+0f },
+    { -0x1.b6ecf175f95e96bep-3L, -0x1.b199c5f68f7ep-68, 0x1.29p+0f },
+    { -0x1.acf5e2db4ec93efep-3L, -0x1.1ecbc0183634bp-71, 0x1.28p+0f },
+    { -0x1.a2f632320b86aca4p-3L, 0x1.deb636a177e24p-69, 0x1.27p+0f },
+    { -0x1.8edcae8352b6bb5cp-3L, -0x1.a8433293369bdp-68, 0x1.25p+0f },
+    { -0x1.84c2bd02f03b2fdep-3L, 0x1.bb6e23138ad52p-68, 0x1.24p+0f },
+    { -0x1.7a9fec7d05ddef18p-3L, 0x1.b25f11f439a48p-71, 0x1.23p+0f },
+    { -0x1.663f6fac913167ccp-3L, -0x1.8a704c288aeb6p-68, 0x1.21p+0f },
+    { -0x1.5c01a39fbd6879fap-3L, -0x1.624140d175ba2p-76, 0x1.2p+0f },
+    { -0x1.51bab907a5c8a48cp-3L, 0x1.feecf48100b47p-68, 0x1.1fp+0f },
+    { -0x1.476a9f983f74d314p-3L, 0x1.c5afa6f024fbp-69, 0x1.1ep+0f },
+    { -0x1.32ae9e278ae1a1f6p-3L, 0x1.c1a7f14b168b3p-68, 0x1.1cp+0f },
+    { -0x1.284294b07a63f8d8p-3L, 0x1.2eaa6b7bba79ap-68, 0x1.1bp+0f },
+    { -0x1.1dcd197552b7b5eap-3L, -0x1.150c1e0e5855dp-69, 0x1.1ap+0f },
+    { -0x1.134e1b489062dff4p-3L, 0x1.4b7dfe0d99a5p-68, 0x1.19p+0f },
+    { -0x1.fc66a0f0b00a4904p-4L, -0x1.a68c72a11bcep-69, 0x1.17p+0f },
+    { -0x1.e72ec117fa5b21ccp-4L, 0x1.251311eb06fd9p-71, 0x1.16p+0f },
+    { -0x1.d1e34e35b82da4dp-4L, -0x1.671e64797cb16p-69, 0x1.15p+0f },
+    { -0x1.bc84240adabba63cp-4L, 0x1.a74b235cd0a8fp-69, 0x1.14p+0f },
+    { -0x1.a7111df348493eb4p-4L, -0x1.16078ef0b4ec5p-70, 0x1.13p+0f },
+    { -0x1.918a16e46335aae8p-4L, 0x1.b9b6d6498b8bap-69, 0x1.12p+0f },
+    { -0x1.663f6fac913167ccp-4L, -0x1.8a704c288aeb6p-69, 0x1.1p+0f },
+    { -0x1.507b836033bb6d5p-4L, 0x1.a59092cba577bp-69, 0x1.0fp+0f },
+    { -0x1.3aa2fdd27f1c2d8p-4L, -0x1.344486d2989dbp-70, 0x1.0ep+0f },
+    { -0x1.24b5b7e135a3c89ap-4L, -0x1.679a8afb2d05bp-71, 0x1.0dp+0f },
+    { -0x1.0eb389fa29f9ab3cp-4L, -0x1.ee975733242e1p-69, 0x1.0cp+0f },
+    { -0x1.f13898332539fa1cp-5L, -0x1.a0d776f2b61edp-70, 0x1.0bp+0f },
+    { -0x1.c4dfab90aab5ef5p-5L, 0x1.c1e586711df5fp-71, 0x1.0ap+0f },
+    { -0x1.985bfc349519460ap-5L, -0x1.c76a1ef4215c8p-74, 0x1.09p+0f },
+    { -0x1.6bad3758efd87314p-5L, 0x1.3f21ed2907deep-70, 0x1.08p+0f },
+    { -0x1.3ed3094685a26202p-5L, -0x1.d2dc0fe24a3d5p-71, 0x1.07p+0f },
+    { -0x1.11cd1d5133412ed8p-5L, -0x1.4504fa934752fp-73, 0x1.06p+0f },
+    { -0x1.c9363ba850f86666p-6L, -0x1.d01ee2e9a7616p-71, 0x1.05p+0f },
+    { -0x1.6e79685c2d2298a6p-6L, -0x1.c4fc4230215f3p-71, 0x1.04p+0f },
+    { -0x1.1363117a97b0c4bcp-6L, 0x1.7cb26dddd6f72p-71, 0x1.03p+0f },
+    { -0x1.6fe50b6ef08517f8p-7L, -0x1.c6f6002f29e89p-72, 0x1.02p+0f },
+    { 0x0p+0L, 0x0p+0, 0x1p+0f },
+};
+
+#define LOG2L_TAB_FOLD 53
+
+/* 1/ln(2) as hi + lo, with hi also split into two 32-bit halves */
+static const long double INVLN2 = 0x1.71547652b82fe178p+0L;
+static const double      INVLN2_LO = -0x1.05e004be5b8bp-65;
+static const long double INVLN2_H = 0x1.71547652p+0L;
+static const long double INVLN2_L = 0x1.705fc2fp-33L;
+
+/* log2(1+r) - (r - r^2/2)/ln(2) = r^3 (P3 + r P(r)), Taylor series to
+   r^10. Only the first coefficient needs more than double precision. */
+static const long double P3 = 0x1.ec709dc3a03fd74ap-2L;
+static const double      P[] = {
+    -0x1.71547652b82fep-2, 0x1.2776c50ef9bfep-2,  -0x1.ec709dc3a03fdp-3, 0x1.a61762a7aded9p-3,
+    -0x1.71547652b82fep-3, 0x1.484b13d7c02a9p-3, -0x1.2776c50ef9bfep-3,
+};
+
+/*
+ * log2(x) as hi + lo for finite x > 0, with lo below 2^-70 |hi| or so.
+ * x = 2^k m, and with c from the table, log2(x) = k - log2(c) + log2(1 + r) where r = m c - 1 is
+ * formed exactly in two parts and |r| <= 2^-7. The leading term of
+ * log2(1 + r) is an exact product, r^2 is rounded only after being
+ * scaled down by r, and the sums are carried with their errors.
+ */
+long double
+__kernel_log2l(long double x, long double *lo)
+{
+    union IEEEl2bits u;
+    long double      c, m, mh, ml, a, b, r, rl, rh, rr, q, p, e, s, t, h, eh, hi;
+    int              k, i;
+
+    u.e = x;
+    k = u.bits.exp;
+    if (k == 0) {
+        u.e *= 0x1p64L;
+        k = u.bits.exp - 64;
+    }
+    k -= LDBL_MAX_EXP - 1;
+    i = (u.bits.manh >> 24) & 0x7f;
+    u.bits.exp = LDBL_MAX_EXP - 1;
+    if (i >= LOG2L_TAB_FOLD) {
+        u.bits.exp = LDBL_MAX_EXP - 2;
+        k++;
+    }
+    m = u.e;
+    c = log2l_tab[i].invc;
+
+    mh = x87_split(m, &ml);
+    a = mh * c - 1.0L;
+    b = ml * c;
+    r = a + b;
+    t = r - a;
+    rl = (a - (r - t)) + (b - t);
+
+    rh = x87_split(r, &rr);
+    p = r * INVLN2;
+    e = ((rh * INVLN2_H - p) + rh * INVLN2_L + rr * INVLN2_H) + rr * INVLN2_L;
+    q = r * r;
+    s = e + (r * INVLN2_LO + rl * INVLN2)
+        + q * (-0.5L * INVLN2
+               + r * (P3 + r * P[0] + q * (P[1] + r * P[2])
+                      + q * q * (P[3] + r * P[4] + q * (P[5] + r * P[6]))));
+
+    /* |k| >= 1 > |logc| unless k is zero, so this sum is exact */
+    a = k + log2l_tab[i].logc;
+    b = (k - a) + log2l_tab[i].logc;
+    h = a + p;
+    t = h - a;
+    eh = (a - (h - t)) + (p - t);
+    hi = h + s;
+    *lo = ((h - hi) + s) + (eh + b + log2l_tab[i].logclo);
+    return hi;
+}
+
+#endif
@@ -0,0 +1,70 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent <agent@local>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Shared pieces of the long double functions in this directory. The
+ * arithmetic relies on the default 64-bit precision control, so that
+ * long double operations round exactly once.
+ */
+
+#ifndef _X87_MATH_H_
+#define _X87_MATH_H_
+
+#include "../../ld/math_ld.h"
+
+/* x rounded to an integer in the current rounding mode */
+static inline long double
+x87_frndint(long double x)
+{
+    long double r;
+    __asm__("frndint" : "=t"(r) : "0"(x));
+    return r;
+}
+
+/* Split x into a high part with the top 32 significand bits and an
+   exact remainder, so that products of high parts are exact. */
+static inline long double
+x87_split(long double x, long double *lo)
+{
+    long double c = x * 0x1.00000001p32L;
+    long double hi = c - (c - x);
+    *lo = x - hi;
+    return hi;
+}
+
+/* log2(x) as hi + lo for finite x > 0 */
+long double __kernel_log2l(long double x, long double *lo);
+
+#endif /* _X87_MATH_H_ */
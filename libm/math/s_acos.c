@@ -36,6 +36,7 @@
  */
 
 #include "fdlibm.h"
+#if __OBSOLETE_MATH_DOUBLE
 
 #ifdef _NEED_FLOAT64
 
@@ -105,3 +106,6 @@ acos64(__float64 x)
 _MATH_ALIAS_d_d(acos)
 
 #endif /* _NEED_FLOAT64 */
+#else
+#include "../common/acos.c"
+#endif /* __OBSOLETE_MATH_DOUBLE */
@@ -42,6 +42,7 @@
  */
 
 #include "fdlibm.h"
+#if __OBSOLETE_MATH_DOUBLE
 
 #ifdef _NEED_FLOAT64
 
@@ -115,3 +116,6 @@ asin64(__float64 x)
 _MATH_ALIAS_d_d(asin)
 
 #endif /* _NEED_FLOAT64 */
+#else
+#include "../common/asin.c"
+#endif /* __OBSOLETE_MATH_DOUBLE */
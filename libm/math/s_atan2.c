@@ -40,6 +40,7 @@
  */
 
 #include "fdlibm.h"
+#if __OBSOLETE_MATH_DOUBLE
 
 #ifdef _NEED_FLOAT64
 
@@ -140,3 +141,6 @@ atan264(__float64 y, __float64 x)
 _MATH_ALIAS_d_dd(atan2)
 
 #endif /* _NEED_FLOAT64 */
+#else
+#include "../common/atan2.c"
+#endif /* __OBSOLETE_MATH_DOUBLE */
@@ -33,6 +33,7 @@
  */
 
 #include "fdlibm.h"
+#if __OBSOLETE_MATH_DOUBLE
 
 #ifdef _NEED_FLOAT64
 
@@ -89,3 +90,6 @@ cosh64(__float64 x)
 _MATH_ALIAS_d_d(cosh)
 
 #endif /* _NEED_FLOAT64 */
+#else
+#include "../common/cosh.c"
+#endif /* __OBSOLETE_MATH_DOUBLE */
@@ -228,6 +228,33 @@ static const __float64 tiny = _F_64(1e-300),
     sb6 = _F_64(4.74528541206955367215e+02),  /* 0x407DA874, 0xE79FE763 */
     sb7 = _F_64(-2.24409524465858183362e+01); /* 0xC03670E2, 0x42712D62 */
 
+#if !__OBSOLETE_MATH_DOUBLE
+#include "exp_core.h"
+
+/*
+ * exp(-x*x + t) for 1.25 <= x < 28 and |t| < 1 in one evaluation of
+ * the exp core. The high half of x squares exactly, and the rest of
+ * x*x joins t in the tail of the argument.
+ */
+static __float64
+erf_exp(__float64 x, __float64 t)
+{
+    __float64 z, hi, tail, y, lo, tmp;
+    uint64_t  sbits, ki;
+
+    z = asfloat64(asuint64(x) & 0xffffffff00000000ULL);
+    hi = -z * z;
+    tail = (z - x) * (z + x) + t;
+    y = hi + tail;
+    lo = (hi - y) + tail;
+    tmp = exp_core(y, lo, &sbits, &ki);
+    if (y <= -512.0)
+        return exp_specialcase(tmp, sbits, ki);
+    z = asfloat64(sbits);
+    return z + z * tmp;
+}
+#endif
+
 __float64
 erf64(__float64 x)
 {
@@ -281,9 +308,13 @@ erf64(__float64 x)
         R = rb0 + s * (rb1 + s * (rb2 + s * (rb3 + s * (rb4 + s * (rb5 + s * rb6)))));
         S = one + s * (sb1 + s * (sb2 + s * (sb3 + s * (sb4 + s * (sb5 + s * (sb6 + s * sb7))))));
     }
+#if __OBSOLETE_MATH_DOUBLE
     z = x;
     SET_LOW_WORD(z, 0);
     r = exp64(-z * z - _F_64(0.5625)) * exp64((z - x) * (z + x) + R / S);
+#else
+    r = erf_exp(x, R / S - _F_64(0.5625));
+#endif
     if (hx >= 0)
         return one - r / x;
     else
@@ -351,9 +382,13 @@ _MATH_ALIAS_d_d(erf)
             S = one
                 + s * (sb1 + s * (sb2 + s * (sb3 + s * (sb4 + s * (sb5 + s * (sb6 + s * sb7))))));
         }
+#if __OBSOLETE_MATH_DOUBLE
         z = x;
         SET_LOW_WORD(z, 0);
         r = exp64(-z * z - _F_64(0.5625)) * exp64((z - x) * (z + x) + R / S);
+#else
+        r = erf_exp(x, R / S - _F_64(0.5625));
+#endif
         if (hx > 0)
             return r / x;
         else
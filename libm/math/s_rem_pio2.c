@@ -15,7 +15,7 @@
 /* __rem_pio2(x,y)
  *
  * return the remainder of x rem pi/2 in y[0]+y[1]
- * use __kernel_rem_pio2()
+ * use integer arithmetic below 2^128, __kernel_rem_pio2() above
  */
 
 #include "fdlibm.h"
@@ -36,6 +36,24 @@ static const __int32_t two_over_pi[] = {
     0x73A8C9, 0x60E27B, 0xC08C6B,
 };
 
+/*
+ * The same bits of 2/pi, 64 per entry, following a zero entry so the
+ * 192 bit window used by rem_pio2_large can start before the binary
+ * point. Enough for |x| < 2^128.
+ */
+static const uint64_t two_over_pi_64[] = {
+    0,
+    0xa2f9836e4e441529ULL,
+    0xfc2757d1f534ddc0ULL,
+    0xdb6295993c439041ULL,
+    0xfe5163abdebbc561ULL,
+    0xb7246e3a424dd2e0ULL,
+};
+
+/* pi/2 * 2^127, rounded */
+#define PIO2_127_HI 0xc90fdaa22168c234ULL
+#define PIO2_127_LO 0xc4c6628b80dc1cd1ULL
+
 static const __int32_t npio2_hw[] = {
     0x3FF921FB, 0x400921FB, 0x4012D97C, 0x401921FB, 0x401F6A7A, 0x4022D97C, 0x4025FDBB, 0x402921FB,
     0x402C463A, 0x402F6A7A, 0x4031475C, 0x4032D97C, 0x40346B9C, 0x4035FDBB, 0x40378FDB, 0x403921FB,
@@ -64,6 +82,116 @@ static const __float64 zero = _F_64(0.00000000000000000000e+00), /* 0x00000000,
     pio2_3 = _F_64(2.02226624871116645580e-21),                  /* 0x3BA3198A, 0x2E000000 */
     pio2_3t = _F_64(8.47842766036889956997e-32);                 /* 0x397B839A, 0x252049C1 */
 
+/* Return the low 64 bits of a * b, storing the high 64 bits in hi */
+static inline uint64_t
+mul128(uint64_t a, uint64_t b, uint64_t *hi)
+{
+#ifdef __SIZEOF_INT128__
+    __uint128_t p = (__uint128_t)a * b;
+    *hi = (uint64_t)(p >> 64);
+    return (uint64_t)p;
+#else
+    uint64_t ahi = a >> 32, alo = a & 0xffffffff;
+    uint64_t bhi = b >> 32, blo = b & 0xffffffff;
+    uint64_t ll = alo * blo;
+    uint64_t lh = alo * bhi;
+    uint64_t hl = ahi * blo;
+    uint64_t mid = (ll >> 32) + (lh & 0xffffffff) + (hl & 0xffffffff);
+
+    *hi = ahi * bhi + (lh >> 32) + (hl >> 32) + (mid >> 32);
+    return (mid << 32) | (ll & 0xffffffff);
+#endif
+}
+
+/*
+ * Reduce 2^20 * pi/2 < |x| < 2^128 with integer arithmetic. Writing
+ * |x| = m * 2^e with a 53 bit integer m, the bits of 2/pi less than
+ * e - 1 places after the binary point only add multiples of 4 to
+ * |x| * 2/pi, so a 192 bit window of the table starting at bit e - 1
+ * gives the quadrant in the top two bits of m * window mod 2^192 and the
+ * fraction in the remaining 190. Truncating 2/pi costs less than 2^-137
+ * in the fraction, far below the closest a double gets to a multiple
+ * of pi/2. The fraction is normalized, multiplied by a 128 bit pi/2
+ * and split into y[0] + y[1].
+ */
+static __int32_t
+rem_pio2_large(__int32_t ix, __uint32_t low, __float64 *y)
+{
+    uint64_t  m = ((uint64_t)((ix & 0xfffff) | 0x100000) << 32) | low;
+    int       b = (ix >> 20) - 1075 - 1 + 63;
+    int       j = b >> 6, sh = b & 63;
+    uint64_t  w0, w1, w2, r0, r1, r2, t0, t1, hi, lo, c;
+    __float64 scale, hi_d, lo_d;
+    int       z, neg;
+    __int32_t n;
+
+    w0 = two_over_pi_64[j];
+    w1 = two_over_pi_64[j + 1];
+    w2 = two_over_pi_64[j + 2];
+    if (sh) {
+        w0 = (w0 << sh) | (w1 >> (64 - sh));
+        w1 = (w1 << sh) | (w2 >> (64 - sh));
+        w2 = (w2 << sh) | (two_over_pi_64[j + 3] >> (64 - sh));
+    }
+
+    /* m * w mod 2^192 */
+    r2 = mul128(m, w2, &hi);
+    r1 = mul128(m, w1, &c);
+    r1 += hi;
+    c += r1 < hi;
+    r0 = m * w0 + c;
+
+    /* Round to the nearest quadrant, leaving a signed fraction */
+    n = (__int32_t)((r0 + (1ULL << 61)) >> 62);
+    r0 -= (uint64_t)n << 62;
+    neg = (int64_t)r0 < 0;
+    if (neg) {
+        r2 = ~r2 + 1;
+        r1 = ~r1 + (r2 == 0);
+        r0 = ~r0 + (r1 == 0 && r2 == 0);
+    }
+
+    /* Normalize so the top bit of r0 is set */
+    z = 0;
+    if (r0 == 0) {
+        r0 = r1;
+        r1 = r2;
+        r2 = 0;
+        z = 64;
+    }
+    if (r0 == 0) {
+        y[0] = y[1] = _F_64(0.0);
+        return n;
+    }
+    sh = __builtin_clzll(r0);
+    if (sh) {
+        r0 = (r0 << sh) | (r1 >> (64 - sh));
+        r1 = (r1 << sh) | (r2 >> (64 - sh));
+    }
+    z += sh;
+
+    /* The fraction is (r0:r1) * 2^(-126-z); multiply by pi/2 */
+    t1 = mul128(r0, PIO2_127_HI, &t0);
+    mul128(r0, PIO2_127_LO, &hi);
+    mul128(r1, PIO2_127_HI, &lo);
+    t1 += hi;
+    t0 += t1 < hi;
+    t1 += lo;
+    t0 += t1 < lo;
+
+    /* y = (t0 + t1 * 2^-64) * 2^(-61-z), split after the top 53 bits */
+    INSERT_WORDS(scale, (1023 - 61 - z) << 20, 0);
+    hi_d = (__float64)(t0 & ~(uint64_t)0x7ff) * scale;
+    lo_d = ((__float64)(__int32_t)(t0 & 0x7ff) + (__float64)t1 * _F_64(0x1p-64)) * scale;
+    y[0] = hi_d + lo_d;
+    y[1] = lo_d - (y[0] - hi_d);
+    if (neg) {
+        y[0] = -y[0];
+        y[1] = -y[1];
+    }
+    return n;
+}
+
 __int32_t
 __rem_pio2(__float64 x, __float64 *y)
 {
@@ -152,8 +280,17 @@ __rem_pio2(__float64 x, __float64 *y)
         y[0] = y[1] = x - x;
         return 0;
     }
-    /* set z = scalbn(|x|,ilogb(x)-23) */
     GET_LOW_WORD(low, x);
+    if (ix < 0x47f00000) { /* |x| < 2^128, integer reduction */
+        n = rem_pio2_large(ix, low, y);
+        if (hx < 0) {
+            y[0] = -y[0];
+            y[1] = -y[1];
+            return -n;
+        }
+        return n;
+    }
+    /* set z = scalbn(|x|,ilogb(x)-23) */
     SET_LOW_WORD(z, low);
     e0 = (int)((ix >> 20) - 1046); /* e0 = ilogb(z)-23; */
     SET_HIGH_WORD(z, ix - lsl((__int32_t)e0, 20));
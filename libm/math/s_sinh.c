@@ -30,6 +30,7 @@
  */
 
 #include "fdlibm.h"
+#if __OBSOLETE_MATH_DOUBLE
 
 #ifdef _NEED_FLOAT64
 
@@ -82,3 +83,6 @@ sinh64(__float64 x)
 _MATH_ALIAS_d_d(sinh)
 
 #endif /* _NEED_FLOAT64 */
+#else
+#include "../common/sinh.c"
+#endif /* __OBSOLETE_MATH_DOUBLE */
@@ -85,6 +85,85 @@
 
 #ifdef _NEED_FLOAT64
 
+#if INTEGER_SQRT
+
+/*
+ * Without an FPU, refine a table estimate of 1/sqrt(m) with two
+ * Goldschmidt iterations in 32-bit fixed point and a third in 64-bit
+ * fixed point, which leaves s within a few ulp of sqrt(m). The
+ * remainder m - s*s then fixes up s and picks the correctly rounded
+ * result.
+ */
+__float64
+sqrt64(__float64 x)
+{
+    uint64_t              ix = asuint64(x);
+    int32_t               e = (int32_t)(ix >> 52);
+    uint64_t              m, s, u;
+    uint32_t              r32, s32, u32;
+    int64_t               d;
+    static const uint32_t three = 0xc0000000; /* 3 in 2.30 */
+
+    if ((uint32_t)(e - 1) >= 0x7ff - 1) {
+        /* zero, subnormal, negative, inf or nan */
+        if ((ix << 1) == 0 || ix == 0x7ff0000000000000ULL)
+            return x; /* sqrt(+-0) = +-0, sqrt(+inf) = +inf */
+        if (ix > 0x7ff0000000000000ULL) {
+            if ((ix << 1) > 0xffe0000000000000ULL)
+                return x + x;         /* sqrt(NaN) = NaN */
+            return __math_invalid(x); /* sqrt(-ve) = sNaN */
+        }
+        /* normalize subnormal x */
+        for (e = 1; (ix & 0x0010000000000000ULL) == 0; e--)
+            ix <<= 1;
+    }
+
+    /* x = m * 4^k with m in [1,4) as 2.62 fixed point */
+    m = ((ix & 0x000fffffffffffffULL) << 10) | 0x4000000000000000ULL;
+    if (!(e & 1))
+        m <<= 1;
+
+    /* r ~ 1/sqrt(m) as 0.32, s ~ sqrt(m) as 2.30 */
+    r32 = (uint32_t)__rsqrt_tab[((e & 1) << 6) | ((ix >> 46) & 0x3f)] << 16;
+    s32 = mul32(m >> 32, r32);
+    u32 = three - mul32(s32, r32);
+    r32 = mul32(r32, u32) << 1;
+    s32 = mul32(s32, u32) << 1;
+    u32 = three - mul32(s32, r32);
+    r32 = mul32(r32, u32) << 1;
+
+    /* Last iteration in 64 bits, r as 0.64 and s as 3.61 */
+    s = mul64(m, (uint64_t)r32 << 32);
+    u = ((uint64_t)three << 32) - mul64(s, (uint64_t)r32 << 32);
+    s = mul64(s, u);
+
+    /* Truncate to 1.52 and make s = floor(sqrt(m)) with d = m - s*s */
+    s >>= 9;
+    d = (int64_t)((m << 42) - s * s);
+    while (d < 0) {
+        s--;
+        d += (int64_t)(2 * s + 1);
+    }
+    while (d > (int64_t)(2 * s)) {
+        d -= (int64_t)(2 * s + 1);
+        s++;
+    }
+
+    /* (s + 1/2)^2 = s*s + s + 1/4, so d > s means round up */
+    if (d != 0) {
+        FE_DECL_ROUND(rnd);
+        if (__is_nearest(rnd))
+            s += d > (int64_t)s;
+        else if (__is_upward(rnd))
+            s++;
+    }
+
+    /* s includes the implicit bit, which carries into the exponent */
+    return asfloat64(((uint64_t)(((e + 1023) >> 1) - 1) << 52) + s);
+}
+
+#else
+
 __float64
 sqrt64(__float64 x)
 {
@@ -191,6 +270,8 @@ sqrt64(__float64 x)
     return z;
 }
 
+#endif /* INTEGER_SQRT */
+
 _MATH_ALIAS_d_d(sqrt)
 
 #endif /* _NEED_FLOAT64 */
@@ -69,6 +69,7 @@ PORTABILITY
  */
 
 #include "fdlibm.h"
+#if __OBSOLETE_MATH_DOUBLE
 
 #ifdef _NEED_FLOAT64
 
@@ -113,3 +114,6 @@ tanh64(__float64 x)
 _MATH_ALIAS_d_d(tanh)
 
 #endif /* _NEED_FLOAT64 */
+#else
+#include "../common/tanh.c"
+#endif /* __OBSOLETE_MATH_DOUBLE */
@@ -15,6 +15,7 @@
  */
 
 #include "fdlibm.h"
+#if __OBSOLETE_MATH_FLOAT
 
 static const float tiny = 1.0e-30, zero = 0.0, pi_o_4 = 7.8539818525e-01, /* 0x3f490fdb */
     pi_o_2 = 1.5707963705e+00,                                            /* 0x3fc90fdb */
@@ -108,3 +109,6 @@ atan2f(float y, float x)
 }
 
 _MATH_ALIAS_f_ff(atan2)
+#else
+#include "../common/sf_atan2.c"
+#endif /* __OBSOLETE_MATH_FLOAT */
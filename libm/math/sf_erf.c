@@ -14,6 +14,7 @@
  */
 
 #include "fdlibm.h"
+#if __OBSOLETE_MATH_FLOAT
 #include "math_config.h"
 
 #ifdef __v810__
@@ -234,3 +235,6 @@ erfcf(float x)
 _MATH_ALIAS_f_f(erf)
 
     _MATH_ALIAS_f_f(erfc)
+#else
+#include "../common/sf_erf.c"
+#endif /* __OBSOLETE_MATH_FLOAT */
@@ -14,6 +14,7 @@
  */
 
 #include "fdlibm.h"
+#if __OBSOLETE_MATH_FLOAT
 
 static const float one = 1.0;
 
@@ -59,3 +60,6 @@ sinhf(float x)
 }
 
 _MATH_ALIAS_f_f(sinh)
+#else
+#include "../common/sf_sinh.c"
+#endif /* __OBSOLETE_MATH_FLOAT */
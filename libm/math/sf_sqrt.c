@@ -15,6 +15,78 @@
 
 #include "fdlibm.h"
 
+#if INTEGER_SQRTF
+
+/*
+ * Without an FPU, refine a table estimate of 1/sqrt(m) with two
+ * Goldschmidt iterations in 32-bit fixed point, which leaves s
+ * within a few ulp of sqrt(m). The remainder m - s*s then fixes up
+ * s and picks the correctly rounded result.
+ */
+float
+sqrtf(float x)
+{
+    uint32_t              ix = asuint(x);
+    int32_t               e = (int32_t)(ix >> 23);
+    uint32_t              m, r, s, u;
+    int32_t               d;
+    static const uint32_t three = 0xc0000000; /* 3 in 2.30 */
+
+    if ((uint32_t)(e - 1) >= 0xff - 1) {
+        /* zero, subnormal, negative, inf or nan */
+        if ((ix << 1) == 0 || ix == 0x7f800000)
+            return x; /* sqrt(+-0) = +-0, sqrt(+inf) = +inf */
+        if (ix > 0x7f800000) {
+            if ((ix << 1) > 0xff000000)
+                return x + x;          /* sqrt(NaN) = NaN */
+            return __math_invalidf(x); /* sqrt(-ve) = sNaN */
+        }
+        /* normalize subnormal x */
+        for (e = 1; (ix & 0x00800000) == 0; e--)
+            ix <<= 1;
+    }
+
+    /* x = m * 4^k with m in [1,4) as 2.30 fixed point */
+    m = ((ix & 0x007fffff) << 7) | 0x40000000;
+    if (!(e & 1))
+        m <<= 1;
+
+    /* r ~ 1/sqrt(m) as 0.32, s ~ sqrt(m) as 2.30 */
+    r = (uint32_t)__rsqrt_tab[((e & 1) << 6) | ((ix >> 17) & 0x3f)] << 16;
+    s = mul32(m, r);
+    u = three - mul32(s, r);
+    r = mul32(r, u) << 1;
+    s = mul32(s, u) << 1;
+    u = three - mul32(s, r);
+    s = mul32(s, u) << 1;
+
+    /* Truncate to 1.23 and make s = floor(sqrt(m)) with d = m - s*s */
+    s >>= 7;
+    d = (int32_t)((m << 16) - s * s);
+    while (d < 0) {
+        s--;
+        d += (int32_t)(2 * s + 1);
+    }
+    while (d > (int32_t)(2 * s)) {
+        d -= (int32_t)(2 * s + 1);
+        s++;
+    }
+
+    /* (s + 1/2)^2 = s*s + s + 1/4, so d > s means round up */
+    if (d != 0) {
+        FE_DECL_ROUND(rnd);
+        if (__is_nearest(rnd))
+            s += d > (int32_t)s;
+        else if (__is_upward(rnd))
+            s++;
+    }
+
+    /* s includes the implicit bit, which carries into the exponent */
+    return asfloat(((uint32_t)(((e + 127) >> 1) - 1) << 23) + s);
+}
+
+#else
+
 float
 sqrtf(float x)
 {
@@ -80,4 +152,6 @@ sqrtf(float x)
     return z;
 }
 
+#endif /* INTEGER_SQRTF */
+
 _MATH_ALIAS_f_f(sqrt)
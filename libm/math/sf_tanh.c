@@ -14,6 +14,7 @@
  */
 
 #include "fdlibm.h"
+#if __OBSOLETE_MATH_FLOAT
 
 static const float one = 1.0, two = 2.0;
 
@@ -53,3 +54,6 @@ tanhf(float x)
 }
 
 _MATH_ALIAS_f_f(tanh)
+#else
+#include "../common/sf_tanh.c"
+#endif /* __OBSOLETE_MATH_FLOAT */
@@ -59,6 +59,60 @@ extern char __tls_end[];
 #define __bss_size  (__bss_end - __bss_start)
 #endif
 
+#if defined(__PICOCRT_PACKED_DATA) && !defined(NO_FLASH)
+
+/*
+ * scripts/picocrt-pack-data replaces the start of the flash copy of
+ * .data with an LZ4 block and sets this flag to the number of bytes
+ * the block expands to. Anything after that, which holds the .tdata
+ * image used by _init_tls, is copied as usual, as are images which
+ * haven't been packed. The flag must stay in read-only memory, so it
+ * isn't declared volatile; the read below keeps the compiler from
+ * using the initializer.
+ */
+__used const uint32_t __picocrt_data_packed = 0;
+
+static size_t
+__picocrt_unpack_len(const uint8_t **srcp, size_t len)
+{
+    const uint8_t *src = *srcp;
+    uint8_t        b;
+
+    if (len == 15) {
+        do {
+            b = *src++;
+            len += b;
+        } while (b == 255);
+    }
+    *srcp = src;
+    return len;
+}
+
+/* Decode an LZ4 block which expands to exactly 'size' bytes */
+static void
+__picocrt_unpack(uint8_t *dst, const uint8_t *src, size_t size)
+{
+    uint8_t       *end = dst + size;
+    const uint8_t *match;
+    uint8_t        token;
+    size_t         len;
+
+    for (;;) {
+        token = *src++;
+        len = __picocrt_unpack_len(&src, token >> 4);
+        while (len--)
+            *dst++ = *src++;
+        if (dst >= end)
+            break;
+        match = dst - (src[0] | ((size_t)src[1] << 8));
+        src += 2;
+        len = __picocrt_unpack_len(&src, token & 15) + 4;
+        while (len--)
+            *dst++ = *match++;
+    }
+}
+#endif
+
 /* These two functions must be defined in the architecture-specific
  * code
  */
@@ -105,8 +159,15 @@ __start(void)
 {
 #ifndef NO_FLASH
     /* Initialize .data from FLASH when enabled */
+#ifdef __PICOCRT_PACKED_DATA
+    uintptr_t packed = *(const volatile uint32_t *)&__picocrt_data_packed;
+    if (packed)
+        __picocrt_unpack((uint8_t *)__data_start, (const uint8_t *)__data_source, packed);
+    memcpy(__data_start + packed, __data_source + packed, (uintptr_t)__data_size - packed);
+#else
     memcpy(__data_start, __data_source, (uintptr_t)__data_size);
 #endif
+#endif
 #ifndef CRT0_LINUX
     memset(__bss_start, '\0', (uintptr_t)__bss_size);
 #endif
@@ -33,10 +33,12 @@
  * OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
-#define _DEFAULT_SOURCE
+#define _GNU_SOURCE
 #include <assert.h>
 #include <pthread.h>
 #include <stdatomic.h>
+#include <stdbool.h>
+#include <time.h>
 
 /*
  * Validate lock usage in libc by creating fake locks
@@ -46,19 +48,44 @@
 #define _LOCK_T struct __lock *
 
 struct __lock {
-    pthread_mutex_t mut;
+    pthread_mutex_t  mut;
+    pthread_rwlock_t rw;
+    bool             is_rw;
 };
 
 struct __lock __lock___libc_recursive_mutex;
 
+/* Per-subsystem locks, so that tests see them separated from the global lock */
+struct __lock __lock___malloc_recursive_mutex;
+struct __lock __lock___env_recursive_mutex;
+struct __lock __lock___tz_mutex;
+struct __lock __lock___atexit_recursive_mutex;
+struct __lock __lock___at_quick_exit_mutex;
+struct __lock __lock___arc4random_mutex;
+struct __lock __lock___sfp_recursive_mutex;
+
+static struct __lock *const static_locks[] = {
+    &__lock___libc_recursive_mutex, &__lock___malloc_recursive_mutex,
+    &__lock___tz_mutex,             &__lock___atexit_recursive_mutex,
+    &__lock___at_quick_exit_mutex,  &__lock___arc4random_mutex,
+    &__lock___sfp_recursive_mutex,
+};
+
 __attribute__((constructor)) static void
 libc_lock_init(void)
 {
     pthread_mutexattr_t mutexattr;
+    unsigned            i;
+
     pthread_mutexattr_init(&mutexattr);
     pthread_mutexattr_settype(&mutexattr, PTHREAD_MUTEX_ERRORCHECK);
 
-    pthread_mutex_init(&__lock___libc_recursive_mutex.mut, &mutexattr);
+    for (i = 0; i < sizeof(static_locks) / sizeof(static_locks[0]); i++)
+        pthread_mutex_init(&static_locks[i]->mut, &mutexattr);
+
+    /* The environment lock is a reader/writer lock */
+    pthread_rwlock_init(&__lock___env_recursive_mutex.rw, NULL);
+    __lock___env_recursive_mutex.is_rw = true;
 }
 
 #define MAX_LOCKS 32
@@ -180,7 +207,11 @@ void __retarget_lock_acquire_recursive(_LOCK_T lock);
 void
 __retarget_lock_acquire_recursive(_LOCK_T lock)
 {
-    int ret = pthread_mutex_lock(&lock->mut);
+    int ret;
+    if (lock->is_rw)
+        ret = pthread_rwlock_wrlock(&lock->rw);
+    else
+        ret = pthread_mutex_lock(&lock->mut);
     (void)ret;
     assert(ret == 0);
 }
@@ -207,7 +238,31 @@ void __retarget_lock_release_recursive(_LOCK_T lock);
 void
 __retarget_lock_release_recursive(_LOCK_T lock)
 {
-    pthread_mutex_unlock(&lock->mut);
+    if (lock->is_rw)
+        pthread_rwlock_unlock(&lock->rw);
+    else
+        pthread_mutex_unlock(&lock->mut);
+}
+
+/* Acquire reader/writer lock shared */
+void __retarget_lock_acquire_shared(_LOCK_T lock);
+
+void
+__retarget_lock_acquire_shared(_LOCK_T lock)
+{
+    assert(lock->is_rw);
+    int ret = pthread_rwlock_rdlock(&lock->rw);
+    (void)ret;
+    assert(ret == 0);
+}
+
+/* Release shared reader/writer lock */
+void __retarget_lock_release_shared(_LOCK_T lock);
+
+void
+__retarget_lock_release_shared(_LOCK_T lock)
+{
+    pthread_rwlock_unlock(&lock->rw);
 }
 
 static pthread_t thread;
@@ -233,11 +288,13 @@ stop_thread(void)
 #define MAX_THREADS 64
 
 static pthread_t         threads[MAX_THREADS];
+static bool              joined[MAX_THREADS];
 static int               nthreads;
 static pthread_barrier_t threads_barrier;
 
 int                      start_threads(int n, void *(*func)(void *), void *arg);
 int                      stop_threads(void);
+int                      stop_threads_timeout(int seconds);
 void                     sync_threads(void);
 
 int
@@ -250,6 +307,7 @@ start_threads(int n, void *(*func)(void *), void *arg)
     pthread_barrier_init(&threads_barrier, NULL, (unsigned)(n + 1));
     for (i = 0; i < n; i++) {
         int ret = pthread_create(&threads[i], NULL, func, arg);
+        joined[i] = false;
         if (ret)
             return ret;
     }
@@ -261,11 +319,34 @@ stop_threads(void)
 {
     int i;
     for (i = 0; i < nthreads; i++)
-        pthread_join(threads[i], NULL);
+        if (!joined[i])
+            pthread_join(threads[i], NULL);
     pthread_barrier_destroy(&threads_barrier);
     return 0;
 }
 
+/*
+ * Join all threads, giving up after 'seconds'. Returns -1 if any
+ * thread is still running; stop_threads will then wait for the rest.
+ */
+int
+stop_threads_timeout(int seconds)
+{
+    struct timespec deadline;
+    int             i;
+
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += seconds;
+    for (i = 0; i < nthreads; i++) {
+        if (joined[i])
+            continue;
+        if (pthread_timedjoin_np(threads[i], NULL, &deadline) != 0)
+            return -1;
+        joined[i] = true;
+    }
+    return 0;
+}
+
 void
 sync_threads(void)
 {
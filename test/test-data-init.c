@@ -0,0 +1,142 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent <agent@local>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Check that crt0 initialized .data and cleared .bss. The data here
+ * mixes runs, repeats and unique values, so that it exercises the
+ * decoder when the image has been run through picocrt-pack-data, which
+ * the test-data-init-packed test does; that build defines
+ * EXPECT_PACKED to make sure the image really was packed.
+ * scripts/boot-time uses this program to measure startup cost.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#define TABLE_SIZE 1024
+
+/* Global so the compiler can't constant-fold the values */
+
+#define R4(x)   (x), (x) + 1, (x) + 2, (x) + 3
+#define R16(x)  R4(x), R4((x) + 4), R4((x) + 8), R4((x) + 12)
+#define R64(x)  R16(x), R16((x) + 16), R16((x) + 32), R16((x) + 48)
+#define R256(x) R64(x), R64((x) + 64), R64((x) + 128), R64((x) + 192)
+
+uint8_t table[TABLE_SIZE] = {
+    R256(0),
+    R256(0),
+    [640] = 0x5a,
+    [700] = 0xa5,
+    [768] = R64(7),
+    [1023] = 0xff,
+};
+
+uint32_t words[] = { 0x01234567, 0x89abcdef, 0x01234567, 0x89abcdef, 0xdeadbeef, 0 };
+
+char message[] = "the quick brown fox jumps over the lazy dog, "
+                        "the quick brown fox jumps over the lazy dog";
+
+uint32_t cleared[16];
+
+#ifdef __THREAD_LOCAL_STORAGE
+/* Stored after .data and left unpacked */
+__THREAD_LOCAL uint32_t tls_words[] = { 0x600df00d, 0x0a0a0a0a };
+#endif
+
+#ifdef EXPECT_PACKED
+extern const uint32_t __picocrt_data_packed;
+#endif
+
+static uint8_t
+expect(int i)
+{
+    if (i < 512)
+        return (uint8_t)i;
+    if (i == 640)
+        return 0x5a;
+    if (i == 700)
+        return 0xa5;
+    if (768 <= i && i < 768 + 64)
+        return (uint8_t)(i - 768 + 7);
+    if (i == 1023)
+        return 0xff;
+    return 0;
+}
+
+int
+main(void)
+{
+    int ret = 0;
+    int i;
+
+    for (i = 0; i < TABLE_SIZE; i++) {
+        if (table[i] != expect(i)) {
+            printf("table[%d] = %#x, expected %#x\n", i, table[i], expect(i));
+            ret = 1;
+        }
+    }
+    if (words[0] != 0x01234567 || words[3] != 0x89abcdef || words[4] != 0xdeadbeef
+        || words[5] != 0) {
+        printf("words mismatch\n");
+        ret = 1;
+    }
+    if (strcmp(message,
+               "the quick brown fox jumps over the lazy dog, "
+               "the quick brown fox jumps over the lazy dog")
+        != 0) {
+        printf("message mismatch: %s\n", message);
+        ret = 1;
+    }
+    for (i = 0; i < 16; i++) {
+        if (cleared[i] != 0) {
+            printf("cleared[%d] = %#lx\n", i, (unsigned long)cleared[i]);
+            ret = 1;
+        }
+    }
+#ifdef __THREAD_LOCAL_STORAGE
+    if (tls_words[0] != 0x600df00d || tls_words[1] != 0x0a0a0a0a) {
+        printf("tls_words mismatch\n");
+        ret = 1;
+    }
+#endif
+#ifdef EXPECT_PACKED
+    if (__picocrt_data_packed == 0) {
+        printf("data was not packed\n");
+        ret = 1;
+    }
+#endif
+    return ret;
+}
@@ -0,0 +1,142 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent <agent@local>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#define _DEFAULT_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+static char *
+naive_utoa(unsigned long long v, char *buf, int base)
+{
+    static const char digits[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+    char              tmp[72];
+    int               n = 0, i = 0;
+
+    do {
+        tmp[n++] = digits[v % base];
+        v /= base;
+    } while (v);
+    while (n)
+        buf[i++] = tmp[--n];
+    buf[i] = '\0';
+    return buf;
+}
+
+static int errors;
+
+static void
+check(const char *what, unsigned long long v, const char *got, const char *expect)
+{
+    if (strcmp(got, expect) != 0) {
+        printf("%s(%llu): got \"%s\" expect \"%s\"\n", what, v, got, expect);
+        errors++;
+    }
+}
+
+static void
+check_value(unsigned long long v)
+{
+    char got[80], expect[80], fmt[80];
+    int  base;
+
+#ifndef NO_NEWLIB
+    /* itoa and utoa are not in glibc */
+    for (base = 2; base <= 36; base++) {
+        utoa((unsigned)v, got, base);
+        check("utoa", v, got, naive_utoa((unsigned)v, expect, base));
+    }
+
+    itoa((int)v, got, 10);
+    if ((int)v < 0) {
+        expect[0] = '-';
+        naive_utoa(-(unsigned long long)(int)v, expect + 1, 10);
+    } else {
+        naive_utoa((unsigned)v, expect, 10);
+    }
+    check("itoa", v, got, expect);
+#endif
+
+    snprintf(got, sizeof(got), "%u", (unsigned)v);
+    check("%u", v, got, naive_utoa((unsigned)v, expect, 10));
+
+    snprintf(got, sizeof(got), "%lu", (unsigned long)v);
+    check("%lu", v, got, naive_utoa((unsigned long)v, expect, 10));
+
+#if !defined(__PICOLIBC__) || defined(_HAS_IO_LONG_LONG)
+    snprintf(got, sizeof(got), "%llu", v);
+    check("%llu", v, got, naive_utoa(v, expect, 10));
+#endif
+
+    snprintf(got, sizeof(got), "%08x", (unsigned)v);
+    snprintf(fmt, sizeof(fmt), "%8s", naive_utoa((unsigned)v, expect, 16));
+    for (base = 0; fmt[base] == ' '; base++)
+        fmt[base] = '0';
+    check("%08x", v, got, fmt);
+}
+
+int
+main(void)
+{
+    unsigned long long p, v;
+    unsigned long long x = 1;
+    int                i;
+
+    /* Powers of ten and their neighbours, plus the edges of each type */
+    for (p = 1; p <= ULLONG_MAX / 10; p *= 10) {
+        check_value(p - 1);
+        check_value(p);
+        check_value(p + 1);
+    }
+    check_value(p);
+    check_value(UINT_MAX);
+    check_value((unsigned)INT_MAX);
+    check_value((unsigned)INT_MIN);
+    check_value(ULONG_MAX);
+    check_value(ULLONG_MAX);
+
+    /* Every value up to 10000 covers all of the digit pairs */
+    for (v = 0; v <= 10000; v++)
+        check_value(v);
+
+    for (i = 0; i < 20000; i++) {
+        x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+        check_value(x >> (i % 64));
+    }
+
+    if (errors)
+        printf("%d errors\n", errors);
+    return errors != 0;
+}
@@ -0,0 +1,84 @@
+{ .x1 = COMPLEX(FN32(0x1.8p0), FN32(0x1p-1), FN64(0x1.8p0), FN64(0x1p-1), FN80(0x1.8p0), FN80(0x1p-1), FN80M(0x1.8p0), FN80M(0x1p-1), FN128(0x1.8p0), FN128(0x1p-1)), .x2 = COMPLEX(FN32(0x1p1), -0, FN64(0x1p1), -0, FN80(0x1p1), -0, FN80M(0x1p1), -0, FN128(0x1p1), -0), .y = COMPLEX(FN32(0x1p1), FN32(0x1.8p0), FN64(0x1p1), FN64(0x1.8p0), FN80(0x1p1), FN80(0x1.8p0), FN80M(0x1p1), FN80M(0x1.8p0), FN128(0x1p1), FN128(0x1.8p0)) },
+{ .x1 = COMPLEX(FN32(0x1.8p0), FN32(0x1p-1), FN64(0x1.8p0), FN64(0x1p-1), FN80(0x1.8p0), FN80(0x1p-1), FN80M(0x1.8p0), FN80M(0x1p-1), FN128(0x1.8p0), FN128(0x1p-1)), .x2 = COMPLEX(FN32(0x1.8p1), -0, FN64(0x1.8p1), -0, FN80(0x1.8p1), -0, FN80M(0x1.8p1), -0, FN128(0x1.8p1), -0), .y = COMPLEX(FN32(0x1.2p1), FN32(0x1.ap1), FN64(0x1.2p1), FN64(0x1.ap1), FN80(0x1.2p1), FN80(0x1.ap1), FN80M(0x1.2p1), FN80M(0x1.ap1), FN128(0x1.2p1), FN128(0x1.ap1)) },
+{ .x1 = COMPLEX(FN32(0x1.8p0), FN32(0x1p-1), FN64(0x1.8p0), FN64(0x1p-1), FN80(0x1.8p0), FN80(0x1p-1), FN80M(0x1.8p0), FN80M(0x1p-1), FN128(0x1.8p0), FN128(0x1p-1)), .x2 = COMPLEX(FN32(0x1.cp2), -0, FN64(0x1.cp2), -0, FN80(0x1.cp2), -0, FN80M(0x1.cp2), -0, FN128(0x1.cp2), -0), .y = COMPLEX(FN32(-0x1.f2p3), FN32(0x1.33p4), FN64(-0x1.f2p3), FN64(0x1.33p4), FN80(-0x1.f2p3), FN80(0x1.33p4), FN80M(-0x1.f2p3), FN80M(0x1.33p4), FN128(-0x1.f2p3), FN128(0x1.33p4)) },
+{ .x1 = COMPLEX(FN32(0x1.8p0), FN32(0x1p-1), FN64(0x1.8p0), FN64(0x1p-1), FN80(0x1.8p0), FN80(0x1p-1), FN80M(0x1.8p0), FN80M(0x1p-1), FN128(0x1.8p0), FN128(0x1p-1)), .x2 = COMPLEX(FN32(0x1p4), -0, FN64(0x1p4), -0, FN80(0x1p4), -0, FN80M(0x1p4), -0, FN128(0x1p4), -0), .y = COMPLEX(FN32(0x1.41f08p9), FN32(-0x1.59d8p10), FN64(0x1.41f08p9), FN64(-0x1.59d8p10), FN80(0x1.41f08p9), FN80(-0x1.59d8p10), FN80M(0x1.41f08p9), FN80M(-0x1.59d8p10), FN128(0x1.41f08p9), FN128(-0x1.59d8p10)) },
+{ .x1 = COMPLEX(FN32(0x1.8p0), FN32(0x1p-1), FN64(0x1.8p0), FN64(0x1p-1), FN80(0x1.8p0), FN80(0x1p-1), FN80M(0x1.8p0), FN80M(0x1p-1), FN128(0x1.8p0), FN128(0x1p-1)), .x2 = COMPLEX(FN32(0x1.08p5), -0, FN64(0x1.08p5), -0, FN80(0x1.08p5), -0, FN80M(0x1.08p5), -0, FN128(0x1.08p5), -0), .y = COMPLEX(FN32(-0x1.4b8a98p20), FN32(-0x1.a1b1b8p21), FN64(-0x1.4b8a988fe8p20), FN64(-0x1.a1b1b8f1fcp21), FN80(-0x1.4b8a988fe8p20), FN80(-0x1.a1b1b8f1fcp21), FN80M(-0x1.4b8a988fe8p20), FN80M(-0x1.a1b1b8f1fcp21), FN128(-0x1.4b8a988fe8p20), FN128(-0x1.a1b1b8f1fcp21)) },
+{ .x1 = COMPLEX(FN32(0x1.8p0), FN32(0x1p-1), FN64(0x1.8p0), FN64(0x1p-1), FN80(0x1.8p0), FN80(0x1p-1), FN80M(0x1.8p0), FN80M(0x1p-1), FN128(0x1.8p0), FN128(0x1p-1)), .x2 = COMPLEX(FN32(0x1p6), -0, FN64(0x1p6), -0, FN80(0x1p6), -0, FN80M(0x1p6), -0, FN128(0x1p6), -0), .y = COMPLEX(FN32(-0x1.af4376p39), FN32(0x1.36e7cap42), FN64(-0x1.af43756c01fep39), FN64(0x1.36e7c96f93224p42), FN80(-0x1.af43756c01fdfc6p39), FN80(0x1.36e7c96f932241dcp42), FN80M(-0x1.af43756c01fdfc6p39), FN80M(0x1.36e7c96f932241dcp42), FN128(-0x1.af43756c01fdfc60fep39), FN128(0x1.36e7c96f932241dcap42)) },
+{ .x1 = COMPLEX(FN32(0x1.8p0), FN32(0x1p-1), FN64(0x1.8p0), FN64(0x1p-1), FN80(0x1.8p0), FN80(0x1p-1), FN80M(0x1.8p0), FN80M(0x1p-1), FN128(0x1.8p0), FN128(0x1p-1)), .x2 = COMPLEX(FN32(-0x1p0), -0, FN64(-0x1p0), -0, FN80(-0x1p0), -0, FN80M(-0x1p0), -0, FN128(-0x1p0), -0), .y = COMPLEX(FN32(0x1.333334p-1), FN32(-0x1.99999ap-3), FN64(0x1.3333333333333p-1), FN64(-0x1.999999999999ap-3), FN80(0x1.3333333333333334p-1), FN80(-0x1.999999999999999ap-3), FN80M(0x1.3333333333333334p-1), FN80M(-0x1.999999999999999ap-3), FN128(0x1.3333333333333333333333333333p-1), FN128(-0x1.999999999999999999999999999ap-3)) },
+{ .x1 = COMPLEX(FN32(0x1.8p0), FN32(0x1p-1), FN64(0x1.8p0), FN64(0x1p-1), FN80(0x1.8p0), FN80(0x1p-1), FN80M(0x1.8p0), FN80M(0x1p-1), FN128(0x1.8p0), FN128(0x1p-1)), .x2 = COMPLEX(FN32(-0x1p1), -0, FN64(-0x1p1), -0, FN80(-0x1p1), -0, FN80M(-0x1p1), -0, FN128(-0x1p1), -0), .y = COMPLEX(FN32(0x1.47ae14p-2), FN32(-0x1.eb851ep-3), FN64(0x1.47ae147ae147bp-2), FN64(-0x1.eb851eb851eb8p-3), FN80(0x1.47ae147ae147ae14p-2), FN80(-0x1.eb851eb851eb851ep-3), FN80M(0x1.47ae147ae147ae14p-2), FN80M(-0x1.eb851eb851eb851ep-3), FN128(0x1.47ae147ae147ae147ae147ae147bp-2), FN128(-0x1.eb851eb851eb851eb851eb851eb8p-3)) },
+{ .x1 = COMPLEX(FN32(0x1.8p0), FN32(0x1p-1), FN64(0x1.8p0), FN64(0x1p-1), FN80(0x1.8p0), FN80(0x1p-1), FN80M(0x1.8p0), FN80M(0x1p-1), FN128(0x1.8p0), FN128(0x1p-1)), .x2 = COMPLEX(FN32(-0x1.4p2), -0, FN64(-0x1.4p2), -0, FN80(-0x1.4p2), -0, FN80M(-0x1.4p2), -0, FN128(-0x1.4p2), -0), .y = COMPLEX(FN32(-0x1.f75104p-9), FN32(-0x1.9e3002p-4), FN64(-0x1.f75104d551d69p-9), FN64(-0x1.9e30014f8b589p-4), FN80(-0x1.f75104d551d68c6ap-9), FN80(-0x1.9e30014f8b588e36p-4), FN80M(-0x1.f75104d551d68c6ap-9), FN80M(-0x1.9e30014f8b588e36p-4), FN128(-0x1.f75104d551d68c692f6e82949a56p-9), FN128(-0x1.9e30014f8b588e368f08461f9f02p-4)) },
+{ .x1 = COMPLEX(FN32(0x1.8p0), FN32(0x1p-1), FN64(0x1.8p0), FN64(0x1p-1), FN80(0x1.8p0), FN80(0x1p-1), FN80M(0x1.8p0), FN80M(0x1p-1), FN128(0x1.8p0), FN128(0x1p-1)), .x2 = COMPLEX(FN32(-0x1p6), -0, FN64(-0x1p6), -0, FN80(-0x1p6), -0, FN80M(-0x1p6), -0, FN128(-0x1p6), -0), .y = COMPLEX(FN32(-0x1.1bdbc2p-45), FN32(-0x1.9946ecp-43), FN64(-0x1.1bdbc1fc94d75p-45), FN64(-0x1.9946eb1c5603cp-43), FN80(-0x1.1bdbc1fc94d75234p-45), FN80(-0x1.9946eb1c5603bfcep-43), FN80M(-0x1.1bdbc1fc94d75234p-45), FN80M(-0x1.9946eb1c5603bfcep-43), FN128(-0x1.1bdbc1fc94d75234da3cd0313522p-45), FN128(-0x1.9946eb1c5603bfcd33eb234ca62ap-43)) },
+{ .x1 = COMPLEX(FN32(-0x1.4p-1), FN32(0x1.cp0), FN64(-0x1.4p-1), FN64(0x1.cp0), FN80(-0x1.4p-1), FN80(0x1.cp0), FN80M(-0x1.4p-1), FN80M(0x1.cp0), FN128(-0x1.4p-1), FN128(0x1.cp0)), .x2 = COMPLEX(FN32(0x1p1), -0, FN64(0x1p1), -0, FN80(0x1p1), -0, FN80M(0x1p1), -0, FN128(0x1p1), -0), .y = COMPLEX(FN32(-0x1.56p1), FN32(-0x1.18p1), FN64(-0x1.56p1), FN64(-0x1.18p1), FN80(-0x1.56p1), FN80(-0x1.18p1), FN80M(-0x1.56p1), FN80M(-0x1.18p1), FN128(-0x1.56p1), FN128(-0x1.18p1)) },
+{ .x1 = COMPLEX(FN32(-0x1.4p-1), FN32(0x1.cp0), FN64(-0x1.4p-1), FN64(0x1.cp0), FN80(-0x1.4p-1), FN80(0x1.cp0), FN80M(-0x1.4p-1), FN80M(0x1.cp0), FN128(-0x1.4p-1), FN128(0x1.cp0)), .x2 = COMPLEX(FN32(0x1.8p1), -0, FN64(0x1.8p1), -0, FN80(0x1.8p1), -0, FN80M(0x1.8p1), -0, FN128(0x1.8p1), -0), .y = COMPLEX(FN32(0x1.5fep2), FN32(-0x1.a78p1), FN64(0x1.5fep2), FN64(-0x1.a78p1), FN80(0x1.5fep2), FN80(-0x1.a78p1), FN80M(0x1.5fep2), FN80M(-0x1.a78p1), FN128(0x1.5fep2), FN128(-0x1.a78p1)) },
+{ .x1 = COMPLEX(FN32(-0x1.4p-1), FN32(0x1.cp0), FN64(-0x1.4p-1), FN64(0x1.cp0), FN80(-0x1.4p-1), FN80(0x1.cp0), FN80M(-0x1.4p-1), FN80M(0x1.cp0), FN128(-0x1.4p-1), FN128(0x1.cp0)), .x2 = COMPLEX(FN32(0x1.cp2), -0, FN64(0x1.cp2), -0, FN80(0x1.cp2), -0, FN80M(0x1.cp2), -0, FN128(0x1.cp2), -0), .y = COMPLEX(FN32(0x1.9cef12p5), FN32(0x1.c3da2ap5), FN64(0x1.9cef11cp5), FN64(0x1.c3da2a8p5), FN80(0x1.9cef11cp5), FN80(0x1.c3da2a8p5), FN80M(0x1.9cef11cp5), FN80M(0x1.c3da2a8p5), FN128(0x1.9cef11cp5), FN128(0x1.c3da2a8p5)) },
+{ .x1 = COMPLEX(FN32(-0x1.4p-1), FN32(0x1.cp0), FN64(-0x1.4p-1), FN64(0x1.cp0), FN80(-0x1.4p-1), FN80(0x1.cp0), FN80M(-0x1.4p-1), FN80M(0x1.cp0), FN128(-0x1.4p-1), FN128(0x1.cp0)), .x2 = COMPLEX(FN32(0x1p4), -0, FN64(0x1p4), -0, FN80(0x1p4), -0, FN80M(0x1p4), -0, FN128(0x1p4), -0), .y = COMPLEX(FN32(0x1.ba7f4ep13), FN32(-0x1.c2e62ep13), FN64(0x1.ba7f4eed349cdp13), FN64(-0x1.c2e62d8c04e82p13), FN80(0x1.ba7f4eed349cd508p13), FN80(-0x1.c2e62d8c04e827p13), FN80M(0x1.ba7f4eed349cd508p13), FN80M(-0x1.c2e62d8c04e827p13), FN128(0x1.ba7f4eed349cd508p13), FN128(-0x1.c2e62d8c04e827p13)) },
+{ .x1 = COMPLEX(FN32(-0x1.4p-1), FN32(0x1.cp0), FN64(-0x1.4p-1), FN64(0x1.cp0), FN80(-0x1.4p-1), FN80(0x1.cp0), FN80M(-0x1.4p-1), FN80M(0x1.cp0), FN128(-0x1.4p-1), FN128(0x1.cp0)), .x2 = COMPLEX(FN32(0x1.08p5), -0, FN64(0x1.08p5), -0, FN80(0x1.08p5), -0, FN80M(0x1.08p5), -0, FN128(0x1.08p5), -0), .y = COMPLEX(FN32(0x1.574524p29), FN32(0x1.cd7522p27), FN64(0x1.574523ef47581p29), FN64(0x1.cd7521d300786p27), FN80(0x1.574523ef47581726p29), FN80(0x1.cd7521d30078614ep27), FN80M(0x1.574523ef47581726p29), FN80M(0x1.cd7521d30078614ep27), FN128(0x1.574523ef47581726209f8e352759p29), FN128(0x1.cd7521d30078614d3ad5d2426dc3p27)) },
+{ .x1 = COMPLEX(FN32(-0x1.4p-1), FN32(0x1.cp0), FN64(-0x1.4p-1), FN64(0x1.cp0), FN80(-0x1.4p-1), FN80(0x1.cp0), FN80M(-0x1.4p-1), FN80M(0x1.cp0), FN128(-0x1.4p-1), FN128(0x1.cp0)), .x2 = COMPLEX(FN32(0x1p6), -0, FN64(0x1p6), -0, FN80(0x1p6), -0, FN80M(0x1p6), -0, FN128(0x1p6), -0), .y = COMPLEX(FN32(-0x1.287e9p57), FN32(0x1.6510e2p52), FN64(-0x1.287e8fd0d0fdep57), FN64(0x1.6510e2be2df4ap52), FN80(-0x1.287e8fd0d0fde796p57), FN80(0x1.6510e2be2df499e8p52), FN80M(-0x1.287e8fd0d0fde796p57), FN80M(0x1.6510e2be2df499e8p52), FN128(-0x1.287e8fd0d0fde795db5f2e2ccd8cp57), FN128(0x1.6510e2be2df499e8d35a8c5ccedap52)) },
+{ .x1 = COMPLEX(FN32(-0x1.4p-1), FN32(0x1.cp0), FN64(-0x1.4p-1), FN64(0x1.cp0), FN80(-0x1.4p-1), FN80(0x1.cp0), FN80M(-0x1.4p-1), FN80M(0x1.cp0), FN128(-0x1.4p-1), FN128(0x1.cp0)), .x2 = COMPLEX(FN32(-0x1p0), -0, FN64(-0x1p0), -0, FN80(-0x1p0), -0, FN80M(-0x1p0), -0, FN128(-0x1p0), -0), .y = COMPLEX(FN32(-0x1.72adc2p-3), FN32(-0x1.0379a2p-1), FN64(-0x1.72adc172adc17p-3), FN64(-0x1.0379a10379a1p-1), FN80(-0x1.72adc172adc172aep-3), FN80(-0x1.0379a10379a1037ap-1), FN80M(-0x1.72adc172adc172aep-3), FN80M(-0x1.0379a10379a1037ap-1), FN128(-0x1.72adc172adc172adc172adc172aep-3), FN128(-0x1.0379a10379a10379a10379a1037ap-1)) },
+{ .x1 = COMPLEX(FN32(-0x1.4p-1), FN32(0x1.cp0), FN64(-0x1.4p-1), FN64(0x1.cp0), FN80(-0x1.4p-1), FN80(0x1.cp0), FN80M(-0x1.4p-1), FN80M(0x1.cp0), FN128(-0x1.4p-1), FN128(0x1.cp0)), .x2 = COMPLEX(FN32(-0x1p1), -0, FN64(-0x1p1), -0, FN80(-0x1p1), -0, FN80M(-0x1p1), -0, FN128(-0x1p1), -0), .y = COMPLEX(FN32(-0x1.cae754p-3), FN32(0x1.77b5e8p-3), FN64(-0x1.cae7540974a65p-3), FN64(0x1.77b5e7fbc3ce8p-3), FN80(-0x1.cae7540974a64802p-3), FN80(0x1.77b5e7fbc3ce7fd2p-3), FN80M(-0x1.cae7540974a64802p-3), FN80M(0x1.77b5e7fbc3ce7fd2p-3), FN128(-0x1.cae7540974a64801f8868f4ac51dp-3), FN128(0x1.77b5e7fbc3ce7fd1b503df9b87eep-3)) },
+{ .x1 = COMPLEX(FN32(-0x1.4p-1), FN32(0x1.cp0), FN64(-0x1.4p-1), FN64(0x1.cp0), FN80(-0x1.4p-1), FN80(0x1.cp0), FN80M(-0x1.4p-1), FN80M(0x1.cp0), FN128(-0x1.4p-1), FN128(0x1.cp0)), .x2 = COMPLEX(FN32(-0x1.4p2), -0, FN64(-0x1.4p2), -0, FN80(-0x1.4p2), -0, FN80M(-0x1.4p2), -0, FN128(-0x1.4p2), -0), .y = COMPLEX(FN32(-0x1.6ddd56p-5), FN32(0x1.a9614cp-8), FN64(-0x1.6ddd569884a4p-5), FN64(0x1.a9614c5eda9ecp-8), FN80(-0x1.6ddd569884a3f90ep-5), FN80(0x1.a9614c5eda9ec046p-8), FN80M(-0x1.6ddd569884a3f90ep-5), FN80M(0x1.a9614c5eda9ec046p-8), FN128(-0x1.6ddd569884a3f90d4e1e59709d16p-5), FN128(0x1.a9614c5eda9ec0458febbee67da7p-8)) },
+{ .x1 = COMPLEX(FN32(-0x1.4p-1), FN32(0x1.cp0), FN64(-0x1.4p-1), FN64(0x1.cp0), FN80(-0x1.4p-1), FN80(0x1.cp0), FN80M(-0x1.4p-1), FN80M(0x1.cp0), FN128(-0x1.4p-1), FN128(0x1.cp0)), .x2 = COMPLEX(FN32(-0x1p6), -0, FN64(-0x1p6), -0, FN80(-0x1p6), -0, FN80M(-0x1p6), -0, FN128(-0x1p6), -0), .y = COMPLEX(FN32(-0x1.b9727ep-58), FN32(-0x1.09d0d8p-62), FN64(-0x1.b9727d3491649p-58), FN64(-0x1.09d0d79305202p-62), FN80(-0x1.b9727d34916496fp-58), FN80(-0x1.09d0d793052027fp-62), FN80M(-0x1.b9727d34916496fp-58), FN80M(-0x1.09d0d793052027fp-62), FN128(-0x1.b9727d34916496efb60b77536981p-58), FN128(-0x1.09d0d793052027f089960a83d7b1p-62)) },
+{ .x1 = COMPLEX(FN32(0x1.fffffep-1), FN32(0x1p-12), FN64(0x1.fffffep-1), FN64(0x1p-12), FN80(0x1.fffffep-1), FN80(0x1p-12), FN80M(0x1.fffffep-1), FN80M(0x1p-12), FN128(0x1.fffffep-1), FN128(0x1p-12)), .x2 = COMPLEX(FN32(0x1p1), -0, FN64(0x1p1), -0, FN80(0x1p1), -0, FN80M(0x1p1), -0, FN128(0x1p1), -0), .y = COMPLEX(FN32(0x1.fffffap-1), FN32(0x1.fffffep-12), FN64(0x1.fffffa000002p-1), FN64(0x1.fffffep-12), FN80(0x1.fffffa000002p-1), FN80(0x1.fffffep-12), FN80M(0x1.fffffa000002p-1), FN80M(0x1.fffffep-12), FN128(0x1.fffffa000002p-1), FN128(0x1.fffffep-12)) },
+{ .x1 = COMPLEX(FN32(0x1.fffffep-1), FN32(0x1p-12), FN64(0x1.fffffep-1), FN64(0x1p-12), FN80(0x1.fffffep-1), FN80(0x1p-12), FN80M(0x1.fffffep-1), FN80M(0x1p-12), FN128(0x1.fffffep-1), FN128(0x1p-12)), .x2 = COMPLEX(FN32(0x1.8p1), -0, FN64(0x1.8p1), -0, FN80(0x1.8p1), -0, FN80M(0x1.8p1), -0, FN128(0x1.8p1), -0), .y = COMPLEX(FN32(0x1.fffff4p-1), FN32(0x1.7ffffcp-11), FN64(0x1.fffff400000cp-1), FN64(0x1.7ffffc8000018p-11), FN80(0x1.fffff400000cp-1), FN80(0x1.7ffffc8000018p-11), FN80M(0x1.fffff400000cp-1), FN80M(0x1.7ffffc8000018p-11), FN128(0x1.fffff400000bfffffep-1), FN128(0x1.7ffffc8000018p-11)) },
+{ .x1 = COMPLEX(FN32(0x1.fffffep-1), FN32(0x1p-12), FN64(0x1.fffffep-1), FN64(0x1p-12), FN80(0x1.fffffep-1), FN80(0x1p-12), FN80M(0x1.fffffep-1), FN80M(0x1p-12), FN128(0x1.fffffep-1), FN128(0x1p-12)), .x2 = COMPLEX(FN32(0x1.cp2), -0, FN64(0x1.cp2), -0, FN80(0x1.cp2), -0, FN80M(0x1.cp2), -0, FN128(0x1.cp2), -0), .y = COMPLEX(FN32(0x1.ffffc8p-1), FN32(0x1.bfffecp-10), FN64(0x1.ffffc8000142p-1), FN64(0x1.bfffecc000428p-10), FN80(0x1.ffffc8000141fffep-1), FN80(0x1.bfffecc000428p-10), FN80M(0x1.ffffc8000141fffep-1), FN80M(0x1.bfffecc000428p-10), FN128(0x1.ffffc8000141fffd360002c9ffffp-1), FN128(0x1.bfffecc000427fff9dc000428p-10)) },
+{ .x1 = COMPLEX(FN32(0x1.fffffep-1), FN32(0x1p-12), FN64(0x1.fffffep-1), FN64(0x1p-12), FN80(0x1.fffffep-1), FN80(0x1p-12), FN80M(0x1.fffffep-1), FN80M(0x1p-12), FN128(0x1.fffffep-1), FN128(0x1p-12)), .x2 = COMPLEX(FN32(0x1p4), -0, FN64(0x1p4), -0, FN80(0x1p4), -0, FN80M(0x1p4), -0, FN128(0x1p4), -0), .y = COMPLEX(FN32(0x1.fffefp-1), FN32(0x1.ffff9cp-9), FN64(0x1.fffef0001c48p-1), FN64(0x1.ffff9c000682p-9), FN80(0x1.fffef0001c47febep-1), FN80(0x1.ffff9c000681ffcap-9), FN80M(0x1.fffef0001c47febep-1), FN80M(0x1.ffff9c000681ffcap-9), FN128(0x1.fffef0001c47febd2007e413e199p-1), FN128(0x1.ffff9c000681ffca12010607fcd3p-9)) },
+{ .x1 = COMPLEX(FN32(0x1.fffffep-1), FN32(0x1p-12), FN64(0x1.fffffep-1), FN64(0x1p-12), FN80(0x1.fffffep-1), FN80(0x1p-12), FN80M(0x1.fffffep-1), FN80M(0x1p-12), FN128(0x1.fffffep-1), FN128(0x1p-12)), .x2 = COMPLEX(FN32(0x1.08p5), -0, FN64(0x1.08p5), -0, FN80(0x1.08p5), -0, FN80M(0x1.08p5), -0, FN128(0x1.08p5), -0), .y = COMPLEX(FN32(0x1.fffb9ep-1), FN32(0x1.07ff34p-7), FN64(0x1.fffb9e01c3afbp-1), FN64(0x1.07ff348032f34p-7), FN80(0x1.fffb9e01c3afb254p-1), FN80(0x1.07ff348032f33996p-7), FN80M(0x1.fffb9e01c3afb254p-1), FN80M(0x1.07ff348032f33996p-7), FN128(0x1.fffb9e01c3afb253777cffd16952p-1), FN128(0x1.07ff348032f339959b7d42cbb717p-7)) },
+{ .x1 = COMPLEX(FN32(0x1.fffffep-1), FN32(0x1p-12), FN64(0x1.fffffep-1), FN64(0x1p-12), FN80(0x1.fffffep-1), FN80(0x1p-12), FN80M(0x1.fffffep-1), FN80M(0x1p-12), FN128(0x1.fffffep-1), FN128(0x1p-12)), .x2 = COMPLEX(FN32(0x1p6), -0, FN64(0x1p6), -0, FN80(0x1p6), -0, FN80M(0x1p6), -0, FN128(0x1p6), -0), .y = COMPLEX(FN32(0x1.ffefcp-1), FN32(0x1.fffa6cp-7), FN64(0x1.ffefc01744121p-1), FN64(0x1.fffa6c04e837ep-7), FN80(0x1.ffefc01744120ef6p-1), FN80(0x1.fffa6c04e837dbb6p-7), FN80M(0x1.ffefc01744120ef6p-1), FN80M(0x1.fffa6c04e837dbb6p-7), FN128(0x1.ffefc01744120ef6253fb2be7b7fp-1), FN128(0x1.fffa6c04e837dbb6226a8aefc99bp-7)) },
+{ .x1 = COMPLEX(FN32(0x1.fffffep-1), FN32(0x1p-12), FN64(0x1.fffffep-1), FN64(0x1p-12), FN80(0x1.fffffep-1), FN80(0x1p-12), FN80M(0x1.fffffep-1), FN80M(0x1p-12), FN128(0x1.fffffep-1), FN128(0x1p-12)), .x2 = COMPLEX(FN32(-0x1p0), -0, FN64(-0x1p0), -0, FN80(-0x1p0), -0, FN80M(-0x1p0), -0, FN128(-0x1p0), -0), .y = COMPLEX(FN32(0x1p0), FN32(-0x1p-12), FN64(0x1.fffffffffffep-1), FN64(-0x1.000001p-12), FN80(0x1.fffffffffffep-1), FN80(-0x1.000001p-12), FN80M(0x1.fffffffffffep-1), FN80M(-0x1.000001p-12), FN128(0x1.fffffffffffdfffffep-1), FN128(-0x1.000000fffffffffffeffffffp-12)) },
+{ .x1 = COMPLEX(FN32(0x1.fffffep-1), FN32(0x1p-12), FN64(0x1.fffffep-1), FN64(0x1p-12), FN80(0x1.fffffep-1), FN80(0x1p-12), FN80M(0x1.fffffep-1), FN80M(0x1p-12), FN128(0x1.fffffep-1), FN128(0x1p-12)), .x2 = COMPLEX(FN32(-0x1p1), -0, FN64(-0x1p1), -0, FN80(-0x1p1), -0, FN80M(-0x1p1), -0, FN128(-0x1p1), -0), .y = COMPLEX(FN32(0x1.fffffep-1), FN32(-0x1p-11), FN64(0x1.fffffdfffff8p-1), FN64(-0x1.000000ffffffp-11), FN80(0x1.fffffdfffff8p-1), FN80(-0x1.000000ffffffp-11), FN80M(0x1.fffffdfffff8p-1), FN80M(-0x1.000000ffffffp-11), FN128(0x1.fffffdfffff7fffffa000006p-1), FN128(-0x1.000000fffffefffffcfffffep-11)) },
+{ .x1 = COMPLEX(FN32(0x1.fffffep-1), FN32(0x1p-12), FN64(0x1.fffffep-1), FN64(0x1p-12), FN80(0x1.fffffep-1), FN80(0x1p-12), FN80M(0x1.fffffep-1), FN80M(0x1p-12), FN128(0x1.fffffep-1), FN128(0x1p-12)), .x2 = COMPLEX(FN32(-0x1.4p2), -0, FN64(-0x1.4p2), -0, FN80(-0x1.4p2), -0, FN80M(-0x1.4p2), -0, FN128(-0x1.4p2), -0), .y = COMPLEX(FN32(0x1.ffffecp-1), FN32(-0x1.3ffffep-10), FN64(0x1.ffffebffffd8p-1), FN64(-0x1.3ffffebffff3cp-10), FN80(0x1.ffffebffffd8p-1), FN80(-0x1.3ffffebffff3cp-10), FN80M(0x1.ffffebffffd8p-1), FN80M(-0x1.3ffffebffff3cp-10), FN128(0x1.ffffebffffd80000460001220001p-1), FN128(-0x1.3ffffebffff3bffff380001ccp-10)) },
+{ .x1 = COMPLEX(FN32(0x1.fffffep-1), FN32(0x1p-12), FN64(0x1.fffffep-1), FN64(0x1p-12), FN80(0x1.fffffep-1), FN80(0x1p-12), FN80M(0x1.fffffep-1), FN80M(0x1p-12), FN128(0x1.fffffep-1), FN128(0x1p-12)), .x2 = COMPLEX(FN32(-0x1p6), -0, FN64(-0x1p6), -0, FN80(-0x1p6), -0, FN80M(-0x1p6), -0, FN128(-0x1p6), -0), .y = COMPLEX(FN32(0x1.fff04p-1), FN32(-0x1.fffaecp-7), FN64(0x1.fff0401343d76p-1), FN64(-0x1.fffaec0392f8fp-7), FN80(0x1.fff0401343d76148p-1), FN80(-0x1.fffaec0392f8eb1cp-7), FN80M(0x1.fff0401343d76148p-1), FN80M(-0x1.fffaec0392f8eb1cp-7), FN128(0x1.fff0401343d7614855f7fc4d4e26p-1), FN128(-0x1.fffaec0392f8eb1bbc85a03537b8p-7)) },
+{ .x1 = COMPLEX(FN32(0x1.8p126), FN32(0x1.8p126), FN64(0x1.8p126), FN64(0x1.8p126), FN80(0x1.8p126), FN80(0x1.8p126), FN80M(0x1.8p126), FN80M(0x1.8p126), FN128(0x1.8p126), FN128(0x1.8p126)), .x2 = COMPLEX(FN32(0x1p1), -0, FN64(0x1p1), -0, FN80(0x1p1), -0, FN80M(0x1p1), -0, FN128(0x1p1), -0), .y = COMPLEX(-0, INFINITY, -0, FN64(0x1.2p254), -0, FN80(0x1.2p254), -0, FN80M(0x1.2p254), -0, FN128(0x1.2p254)) },
+{ .x1 = COMPLEX(FN32(0x1.8p126), FN32(0x1.8p126), FN64(0x1.8p126), FN64(0x1.8p126), FN80(0x1.8p126), FN80(0x1.8p126), FN80M(0x1.8p126), FN80M(0x1.8p126), FN128(0x1.8p126), FN128(0x1.8p126)), .x2 = COMPLEX(FN32(0x1.8p1), -0, FN64(0x1.8p1), -0, FN80(0x1.8p1), -0, FN80M(0x1.8p1), -0, FN128(0x1.8p1), -0), .y = COMPLEX(-INFINITY, INFINITY, FN64(-0x1.bp380), FN64(0x1.bp380), FN80(-0x1.bp380), FN80(0x1.bp380), FN80M(-0x1.bp380), FN80M(0x1.bp380), FN128(-0x1.bp380), FN128(0x1.bp380)) },
+{ .x1 = COMPLEX(FN32(0x1.8p126), FN32(0x1.8p126), FN64(0x1.8p126), FN64(0x1.8p126), FN80(0x1.8p126), FN80(0x1.8p126), FN80M(0x1.8p126), FN80M(0x1.8p126), FN128(0x1.8p126), FN128(0x1.8p126)), .x2 = COMPLEX(FN32(0x1.cp2), -0, FN64(0x1.cp2), -0, FN80(0x1.cp2), -0, FN80M(0x1.cp2), -0, FN128(0x1.cp2), -0), .y = COMPLEX(INFINITY, -INFINITY, FN64(0x1.116p889), FN64(-0x1.116p889), FN80(0x1.116p889), FN80(-0x1.116p889), FN80M(0x1.116p889), FN80M(-0x1.116p889), FN128(0x1.116p889), FN128(-0x1.116p889)) },
+{ .x1 = COMPLEX(FN32(0x1.8p126), FN32(0x1.8p126), FN64(0x1.8p126), FN64(0x1.8p126), FN80(0x1.8p126), FN80(0x1.8p126), FN80M(0x1.8p126), FN80M(0x1.8p126), FN128(0x1.8p126), FN128(0x1.8p126)), .x2 = COMPLEX(FN32(0x1p4), -0, FN64(0x1p4), -0, FN80(0x1p4), -0, FN80M(0x1p4), -0, FN128(0x1p4), -0), .y = COMPLEX(INFINITY, -0, INFINITY, -0, FN80(0x1.486ba08p2033), -0, FN80M(0x1.486ba08p2033), -0, FN128(0x1.486ba08p2033), -0) },
+{ .x1 = COMPLEX(FN32(0x1.8p126), FN32(0x1.8p126), FN64(0x1.8p126), FN64(0x1.8p126), FN80(0x1.8p126), FN80(0x1.8p126), FN80M(0x1.8p126), FN80M(0x1.8p126), FN128(0x1.8p126), FN128(0x1.8p126)), .x2 = COMPLEX(FN32(0x1.08p5), -0, FN64(0x1.08p5), -0, FN80(0x1.08p5), -0, FN80M(0x1.08p5), -0, FN128(0x1.08p5), -0), .y = COMPLEX(INFINITY, INFINITY, INFINITY, INFINITY, FN80(0x1.3bfefa65abb83p4193), FN80(0x1.3bfefa65abb83p4193), FN80M(0x1.3bfefa65abb83p4193), FN80M(0x1.3bfefa65abb83p4193), FN128(0x1.3bfefa65abb83p4193), FN128(0x1.3bfefa65abb83p4193)) },
+{ .x1 = COMPLEX(FN32(0x1.8p126), FN32(0x1.8p126), FN64(0x1.8p126), FN64(0x1.8p126), FN80(0x1.8p126), FN80(0x1.8p126), FN80M(0x1.8p126), FN80M(0x1.8p126), FN128(0x1.8p126), FN128(0x1.8p126)), .x2 = COMPLEX(FN32(0x1p6), -0, FN64(0x1p6), -0, FN80(0x1p6), -0, FN80M(0x1p6), -0, FN128(0x1p6), -0), .y = COMPLEX(INFINITY, -0, INFINITY, -0, FN80(0x1.5ab6a57c7bc9913cp8133), -0, FN80M(0x1.5ab6a57c7bc9913cp8133), -0, FN128(0x1.5ab6a57c7bc9913c63cbf5e808p8133), -0) },
+{ .x1 = COMPLEX(FN32(0x1.8p126), FN32(0x1.8p126), FN64(0x1.8p126), FN64(0x1.8p126), FN80(0x1.8p126), FN80(0x1.8p126), FN80M(0x1.8p126), FN80M(0x1.8p126), FN128(0x1.8p126), FN128(0x1.8p126)), .x2 = COMPLEX(FN32(-0x1p0), -0, FN64(-0x1p0), -0, FN80(-0x1p0), -0, FN80M(-0x1p0), -0, FN128(-0x1p0), -0), .y = COMPLEX(FN32(0x1.555558p-128), FN32(-0x1.555558p-128), FN64(0x1.5555555555555p-128), FN64(-0x1.5555555555555p-128), FN80(0x1.5555555555555556p-128), FN80(-0x1.5555555555555556p-128), FN80M(0x1.5555555555555556p-128), FN80M(-0x1.5555555555555556p-128), FN128(0x1.5555555555555555555555555555p-128), FN128(-0x1.5555555555555555555555555555p-128)) },
+{ .x1 = COMPLEX(FN32(0x1.8p126), FN32(0x1.8p126), FN64(0x1.8p126), FN64(0x1.8p126), FN80(0x1.8p126), FN80(0x1.8p126), FN80M(0x1.8p126), FN80M(0x1.8p126), FN128(0x1.8p126), FN128(0x1.8p126)), .x2 = COMPLEX(FN32(-0x1p1), -0, FN64(-0x1p1), -0, FN80(-0x1p1), -0, FN80M(-0x1p1), -0, FN128(-0x1p1), -0), .y = COMPLEX(-0, -0, -0, FN64(-0x1.c71c71c71c71cp-255), -0, FN80(-0x1.c71c71c71c71c71cp-255), -0, FN80M(-0x1.c71c71c71c71c71cp-255), -0, FN128(-0x1.c71c71c71c71c71c71c71c71c71cp-255)) },
+{ .x1 = COMPLEX(FN32(0x1.8p126), FN32(0x1.8p126), FN64(0x1.8p126), FN64(0x1.8p126), FN80(0x1.8p126), FN80(0x1.8p126), FN80M(0x1.8p126), FN80M(0x1.8p126), FN128(0x1.8p126), FN128(0x1.8p126)), .x2 = COMPLEX(FN32(-0x1.4p2), -0, FN64(-0x1.4p2), -0, FN80(-0x1.4p2), -0, FN80M(-0x1.4p2), -0, FN128(-0x1.4p2), -0), .y = COMPLEX(-0, 0, FN64(-0x1.0db20a88f4696p-636), FN64(0x1.0db20a88f4696p-636), FN80(-0x1.0db20a88f469598cp-636), FN80(0x1.0db20a88f469598cp-636), FN80M(-0x1.0db20a88f469598cp-636), FN80M(0x1.0db20a88f469598cp-636), FN128(-0x1.0db20a88f469598c1d7f7926fabcp-636), FN128(0x1.0db20a88f469598c1d7f7926fabcp-636)) },
+{ .x1 = COMPLEX(FN32(0x1.8p126), FN32(0x1.8p126), FN64(0x1.8p126), FN64(0x1.8p126), FN80(0x1.8p126), FN80(0x1.8p126), FN80M(0x1.8p126), FN80M(0x1.8p126), FN128(0x1.8p126), FN128(0x1.8p126)), .x2 = COMPLEX(FN32(-0x1p6), -0, FN64(-0x1p6), -0, FN80(-0x1p6), -0, FN80M(-0x1p6), -0, FN128(-0x1p6), -0), .y = COMPLEX(0, -0, 0, -0, FN80(0x1.7a0a91194ed93d68p-8134), -0, FN80M(0x1.7a0a91194ed93d68p-8134), -0, FN128(0x1.7a0a91194ed93d677fdf3f3858acp-8134), -0) },
+{ .x1 = COMPLEX(FN32(-0x1.8p-99), FN32(0x1p-99), FN64(-0x1.8p-99), FN64(0x1p-99), FN80(-0x1.8p-99), FN80(0x1p-99), FN80M(-0x1.8p-99), FN80M(0x1p-99), FN128(-0x1.8p-99), FN128(0x1p-99)), .x2 = COMPLEX(FN32(0x1p1), -0, FN64(0x1p1), -0, FN80(0x1p1), -0, FN80M(0x1p1), -0, FN128(0x1p1), -0), .y = COMPLEX(0, -0, FN64(0x1.4p-198), FN64(-0x1.8p-197), FN80(0x1.4p-198), FN80(-0x1.8p-197), FN80M(0x1.4p-198), FN80M(-0x1.8p-197), FN128(0x1.4p-198), FN128(-0x1.8p-197)) },
+{ .x1 = COMPLEX(FN32(-0x1.8p-99), FN32(0x1p-99), FN64(-0x1.8p-99), FN64(0x1p-99), FN80(-0x1.8p-99), FN80(0x1p-99), FN80M(-0x1.8p-99), FN80M(0x1p-99), FN128(-0x1.8p-99), FN128(0x1p-99)), .x2 = COMPLEX(FN32(0x1.8p1), -0, FN64(0x1.8p1), -0, FN80(0x1.8p1), -0, FN80M(0x1.8p1), -0, FN128(0x1.8p1), -0), .y = COMPLEX(0, 0, FN64(0x1.2p-297), FN64(0x1.7p-295), FN80(0x1.2p-297), FN80(0x1.7p-295), FN80M(0x1.2p-297), FN80M(0x1.7p-295), FN128(0x1.2p-297), FN128(0x1.7p-295)) },
+{ .x1 = COMPLEX(FN32(-0x1.8p-99), FN32(0x1p-99), FN64(-0x1.8p-99), FN64(0x1p-99), FN80(-0x1.8p-99), FN80(0x1p-99), FN80M(-0x1.8p-99), FN80M(0x1p-99), FN128(-0x1.8p-99), FN128(0x1p-99)), .x2 = COMPLEX(FN32(0x1.cp2), -0, FN64(0x1.cp2), -0, FN80(0x1.cp2), -0, FN80M(0x1.cp2), -0, FN128(0x1.cp2), -0), .y = COMPLEX(0, -0, FN64(0x1.161p-688), FN64(-0x1.99ap-688), FN80(0x1.161p-688), FN80(-0x1.99ap-688), FN80M(0x1.161p-688), FN80M(-0x1.99ap-688), FN128(0x1.161p-688), FN128(-0x1.99ap-688)) },
+{ .x1 = COMPLEX(FN32(-0x1.8p-99), FN32(0x1p-99), FN64(-0x1.8p-99), FN64(0x1p-99), FN80(-0x1.8p-99), FN80(0x1p-99), FN80M(-0x1.8p-99), FN80M(0x1p-99), FN128(-0x1.8p-99), FN128(0x1p-99)), .x2 = COMPLEX(FN32(0x1p4), -0, FN64(0x1p4), -0, FN80(0x1p4), -0, FN80M(0x1p4), -0, FN128(0x1p4), -0), .y = COMPLEX(-0, -0, -0, -0, FN80(-0x1.84ea8ef8p-1571), FN80(-0x1.a09dcp-1577), FN80M(-0x1.84ea8ef8p-1571), FN80M(-0x1.a09dcp-1577), FN128(-0x1.84ea8ef8p-1571), FN128(-0x1.a09dcp-1577)) },
+{ .x1 = COMPLEX(FN32(-0x1.8p-99), FN32(0x1p-99), FN64(-0x1.8p-99), FN64(0x1p-99), FN80(-0x1.8p-99), FN80(0x1p-99), FN80M(-0x1.8p-99), FN80M(0x1p-99), FN128(-0x1.8p-99), FN128(0x1p-99)), .x2 = COMPLEX(FN32(0x1.08p5), -0, FN64(0x1.08p5), -0, FN80(0x1.08p5), -0, FN80M(0x1.08p5), -0, FN128(0x1.08p5), -0), .y = COMPLEX(-0, 0, -0, 0, FN80(-0x1.c4e5cd69b5d2943p-3240), FN80(0x1.18812f3d015b9c2p-3240), FN80M(-0x1.c4e5cd69b5d2943p-3240), FN80M(0x1.18812f3d015b9c2p-3240), FN128(-0x1.c4e5cd69b5d2943p-3240), FN128(0x1.18812f3d015b9c2p-3240)) },
+{ .x1 = COMPLEX(FN32(-0x1.8p-99), FN32(0x1p-99), FN64(-0x1.8p-99), FN64(0x1p-99), FN80(-0x1.8p-99), FN80(0x1p-99), FN80M(-0x1.8p-99), FN80M(0x1p-99), FN128(-0x1.8p-99), FN128(0x1p-99)), .x2 = COMPLEX(FN32(0x1p6), -0, FN64(0x1p6), -0, FN80(0x1p6), -0, FN80M(0x1p6), -0, FN128(0x1p6), -0), .y = COMPLEX(0, 0, 0, 0, FN80(0x1.545735ca06af1418p-6282), FN80(0x1.6d17aa144d3c44aap-6286), FN80M(0x1.545735ca06af1418p-6282), FN80M(0x1.6d17aa144d3c44aap-6286), FN128(0x1.545735ca06af1417eef19944d0e2p-6282), FN128(0x1.6d17aa144d3c44aa90df66ee5d2p-6286)) },
+{ .x1 = COMPLEX(FN32(-0x1.8p-99), FN32(0x1p-99), FN64(-0x1.8p-99), FN64(0x1p-99), FN80(-0x1.8p-99), FN80(0x1p-99), FN80M(-0x1.8p-99), FN80M(0x1p-99), FN128(-0x1.8p-99), FN128(0x1p-99)), .x2 = COMPLEX(FN32(-0x1p0), -0, FN64(-0x1p0), -0, FN80(-0x1p0), -0, FN80M(-0x1p0), -0, FN128(-0x1p0), -0), .y = COMPLEX(FN32(-0x1.d89d8ap97), FN32(-0x1.3b13b2p97), FN64(-0x1.d89d89d89d89ep97), FN64(-0x1.3b13b13b13b14p97), FN80(-0x1.d89d89d89d89d89ep97), FN80(-0x1.3b13b13b13b13b14p97), FN80M(-0x1.d89d89d89d89d89ep97), FN80M(-0x1.3b13b13b13b13b14p97), FN128(-0x1.d89d89d89d89d89d89d89d89d89ep97), FN128(-0x1.3b13b13b13b13b13b13b13b13b14p97)) },
+{ .x1 = COMPLEX(FN32(-0x1.8p-99), FN32(0x1p-99), FN64(-0x1.8p-99), FN64(0x1p-99), FN80(-0x1.8p-99), FN80(0x1p-99), FN80M(-0x1.8p-99), FN80M(0x1p-99), FN128(-0x1.8p-99), FN128(0x1p-99)), .x2 = COMPLEX(FN32(-0x1p1), -0, FN64(-0x1p1), -0, FN80(-0x1p1), -0, FN80M(-0x1p1), -0, FN128(-0x1p1), -0), .y = COMPLEX(INFINITY, INFINITY, FN64(0x1.e4bbd595f6e94p194), FN64(0x1.22d719c060f26p196), FN80(0x1.e4bbd595f6e94732p194), FN80(0x1.22d719c060f25deap196), FN80M(0x1.e4bbd595f6e94732p194), FN80M(0x1.22d719c060f25deap196), FN128(0x1.e4bbd595f6e94731fcf86d10a9a8p194), FN128(0x1.22d719c060f25deacafb74a398fep196)) },
+{ .x1 = COMPLEX(FN32(-0x1.8p-99), FN32(0x1p-99), FN64(-0x1.8p-99), FN64(0x1p-99), FN80(-0x1.8p-99), FN80(0x1p-99), FN80M(-0x1.8p-99), FN80M(0x1p-99), FN128(-0x1.8p-99), FN128(0x1p-99)), .x2 = COMPLEX(FN32(-0x1.4p2), -0, FN64(-0x1.4p2), -0, FN80(-0x1.4p2), -0, FN80M(-0x1.4p2), -0, FN128(-0x1.4p2), -0), .y = COMPLEX(INFINITY, -INFINITY, FN64(0x1.a57ffa70a4bc9p490), FN64(-0x1.588aeabb45e8ap488), FN80(0x1.a57ffa70a4bc95ap490), FN80(-0x1.588aeabb45e8a00ap488), FN80M(0x1.a57ffa70a4bc95ap490), FN80M(-0x1.588aeabb45e8a00ap488), FN128(0x1.a57ffa70a4bc95a03efdb9b3a5eap490), FN128(-0x1.588aeabb45e8a00aebe0fb47ce6p488)) },
+{ .x1 = COMPLEX(FN32(-0x1.8p-99), FN32(0x1p-99), FN64(-0x1.8p-99), FN64(0x1p-99), FN80(-0x1.8p-99), FN80(0x1p-99), FN80M(-0x1.8p-99), FN80M(0x1p-99), FN128(-0x1.8p-99), FN128(0x1p-99)), .x2 = COMPLEX(FN32(-0x1p6), -0, FN64(-0x1p6), -0, FN80(-0x1p6), -0, FN80M(-0x1p6), -0, FN128(-0x1p6), -0), .y = COMPLEX(INFINITY, -INFINITY, INFINITY, -INFINITY, FN80(0x1.7f658828149b5f4ep6281), FN80(-0x1.9b4799c42fa16352p6277), FN80M(0x1.7f658828149b5f4ep6281), FN80M(-0x1.9b4799c42fa16352p6277), FN128(0x1.7f658828149b5f4e4b32b97b028p6281), FN128(-0x1.9b4799c42fa163513609db438268p6277)) },
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2025 Keith Packard
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
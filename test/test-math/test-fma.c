@@ -320,6 +320,76 @@ test_fmal(void)
 #define test_fmal() 0
 #endif
 
+#if defined(FE_UNDERFLOW) && defined(FE_INEXACT) && defined(FE_TONEAREST)
+
+/*
+ * Results just below the smallest normal which round up to it as
+ * subnormals, but not when rounded to full precision with an unbounded
+ * exponent. These are tiny both before and after rounding, so they
+ * must raise underflow.
+ */
+#ifndef __FLOAT_NOEXCEPT
+static const struct {
+    float x, y, z, r;
+    int   except;
+} fmaf_tiny_vec[] = {
+    { 0x1.8p-75f, -0x1p-76f, 0x1p-126f, 0x1p-126f, FE_UNDERFLOW | FE_INEXACT },
+};
+#endif
+
+#ifndef __DOUBLE_NOEXCEPT
+static const struct {
+    double x, y, z, r;
+    int    except;
+} fma_tiny_vec[] = {
+    { 0x1.8p-600, -0x1p-476, 0x1p-1022, 0x1p-1022, FE_UNDERFLOW | FE_INEXACT },
+};
+#endif
+
+#define EXCEPT_MASK (FE_UNDERFLOW | FE_INEXACT)
+
+static int
+test_fma_tiny(void)
+{
+    int          ret = 0;
+    int          defround = fegetround();
+    unsigned int t;
+    int          except;
+
+    fesetround(FE_TONEAREST);
+#ifndef __FLOAT_NOEXCEPT
+    for (t = 0; t < sizeof(fmaf_tiny_vec) / sizeof(fmaf_tiny_vec[0]); t++) {
+        volatile float x = fmaf_tiny_vec[t].x;
+        feclearexcept(FE_ALL_EXCEPT);
+        volatile float r = fmaf(x, fmaf_tiny_vec[t].y, fmaf_tiny_vec[t].z);
+        except = fetestexcept(EXCEPT_MASK);
+        if (r != fmaf_tiny_vec[t].r || except != fmaf_tiny_vec[t].except) {
+            printf("fmaf tiny %u: got %a except 0x%x want %a except 0x%x\n", t, (double)r,
+                   except, (double)fmaf_tiny_vec[t].r, fmaf_tiny_vec[t].except);
+            ret = 1;
+        }
+    }
+#endif
+#ifndef __DOUBLE_NOEXCEPT
+    for (t = 0; t < sizeof(fma_tiny_vec) / sizeof(fma_tiny_vec[0]); t++) {
+        volatile double x = fma_tiny_vec[t].x;
+        feclearexcept(FE_ALL_EXCEPT);
+        volatile double r = fma(x, fma_tiny_vec[t].y, fma_tiny_vec[t].z);
+        except = fetestexcept(EXCEPT_MASK);
+        if (r != fma_tiny_vec[t].r || except != fma_tiny_vec[t].except) {
+            printf("fma tiny %u: got %a except 0x%x want %a except 0x%x\n", t, r, except,
+                   fma_tiny_vec[t].r, fma_tiny_vec[t].except);
+            ret = 1;
+        }
+    }
+#endif
+    fesetround(defround);
+    return ret;
+}
+#else
+#define test_fma_tiny() 0
+#endif
+
 int
 main(void)
 {
@@ -341,6 +411,7 @@ main(void)
     int ret = 0;
     ret |= test_fmaf();
     ret |= test_fma();
+    ret |= test_fma_tiny();
 #if defined(__m68k__) && __LDBL_MIN_EXP__ == -16382
     volatile long double big = 0x1p+16383l;
     volatile long double small = 0x1p-16446l;
@@ -474,6 +474,7 @@ culp128(cbinary128 a, cbinary128 b)
 #define sincos_sin 1
 #define sincos_cos 2
 #define remquo_quo 3
+#define cpow_int   4
 
 #if TEST_FUNC == sincos_sin
 #define TEST_FUNC_SINCOS_SIN
@@ -481,11 +482,14 @@ culp128(cbinary128 a, cbinary128 b)
 #define TEST_FUNC_SINCOS_COS
 #elif TEST_FUNC == remquo_quo
 #define TEST_FUNC_REMQUO_QUO
+#elif TEST_FUNC == cpow_int
+#define TEST_FUNC_CPOW_INT
 #endif
 
 #undef sincos_sin
 #undef sincos_cos
 #undef remquo_quo
+#undef cpow_int
 
 #ifdef TEST_FUNC_SINCOS_SIN
 #ifdef TEST_FUNC_32
@@ -679,4 +683,50 @@ TEST_FUNC_128(binary128 x, binary128 y)
 
 #endif /* TEST_FUNC_REMQUO_QUO */
 
+#ifdef TEST_FUNC_CPOW_INT
+
+/* cpow with integral exponents, which take a separate path */
+
+#ifdef HAS_BINARY32
+cbinary32 TEST_FUNC_32(cbinary32 x, cbinary32 y);
+
+cbinary32
+TEST_FUNC_32(cbinary32 x, cbinary32 y)
+{
+    return FN32(cpow)(x, y);
+}
+#endif
+
+#ifdef HAS_BINARY64
+cbinary64 TEST_FUNC_64(cbinary64 x, cbinary64 y);
+
+cbinary64
+TEST_FUNC_64(cbinary64 x, cbinary64 y)
+{
+    return FN64(cpow)(x, y);
+}
+#endif
+
+#ifdef HAS_BINARY80
+cbinary80 TEST_FUNC_80(cbinary80 x, cbinary80 y);
+
+cbinary80
+TEST_FUNC_80(cbinary80 x, cbinary80 y)
+{
+    return FN80(cpow)(x, y);
+}
+#endif
+
+#ifdef HAS_BINARY128
+cbinary128 TEST_FUNC_128(cbinary128 x, cbinary128 y);
+
+cbinary128
+TEST_FUNC_128(cbinary128 x, cbinary128 y)
+{
+    return FN128(cpow)(x, y);
+}
+#endif
+
+#endif /* TEST_FUNC_CPOW_INT */
+
 #endif /* _TEST_MATH_H_ */
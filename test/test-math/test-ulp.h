@@ -125,6 +125,7 @@ static TEST_CONST math_ulps_t math_ulps[] = {
     { .name = "clog", .b32 = 4, .b64 = 6, .b80 = 5, .b128 = 6 },
 #endif
     { .name = "cpow",       .b32 = INV_ULP, .b64 = INV_ULP, .b80 = INV_ULP, .b128 = INV_ULP },
+    { .name = "cpow_int",   .b32 = 16,      .b64 = 1,       .b80 = 2,       .b128 = 2       },
 
 /* Complex misc functions */
 #if defined(__riscv_float_abi_soft) || defined(__clang__)
@@ -201,6 +202,7 @@ static TEST_CONST math_ulps_t math_ulps[] = {
     { .name = "cexp", .b32 = 1, .b64 = 1, .b80 = 1, .b128 = 1 },
     { .name = "clog", .b32 = 1, .b64 = 1, .b80 = 1, .b128 = 1 },
     { .name = "cpow", .b32 = 169, .b64 = MAX_ULP, .b80 = MAX_ULP, .b128 = MAX_ULP },
+    { .name = "cpow_int", .b32 = 24, .b64 = 579, .b80 = 2425, .b128 = MAX_ULP },
 
     /* Complex misc functions */
     { .name = "csqrt", .b32 = 1, .b64 = 1, .b80 = 1, .b128 = 1 },
@@ -0,0 +1,312 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent <agent@local>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Check timegm and mktime against a straightforward reference
+ * implementation which normalizes the structure one month and one year
+ * at a time. Define MKTIME_BENCH to also report the throughput of both.
+ */
+
+#define _DEFAULT_SOURCE
+#include <time.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef MKTIME_BENCH
+#define NUM_TEST  20000
+#define NUM_BENCH 20
+#else
+#define NUM_TEST 2000
+#endif
+
+static struct tm tests[NUM_TEST];
+
+static uint32_t seed = 0x12345678;
+
+static int
+rand_range(int min, int max)
+{
+    seed = seed * 1103515245 + 12345;
+    return min + (int)((seed >> 8) % (uint32_t)(max - min + 1));
+}
+
+static bool
+ref_isleap(long y)
+{
+    y += 1900;
+    return y % 4 == 0 && (y % 100 != 0 || y % 400 == 0);
+}
+
+static int
+ref_mdays(long y, int m)
+{
+    static const int mdays[12] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    return mdays[m] + (m == 1 && ref_isleap(y));
+}
+
+static void
+ref_norm(int *lo, int *hi, int n)
+{
+    while (*lo < 0) {
+        *lo += n;
+        --*hi;
+    }
+    while (*lo >= n) {
+        *lo -= n;
+        ++*hi;
+    }
+}
+
+static long long
+ref_timegm(struct tm *tm)
+{
+    long long days = 0;
+    long      y;
+    int       m;
+
+    ref_norm(&tm->tm_sec, &tm->tm_min, 60);
+    ref_norm(&tm->tm_min, &tm->tm_hour, 60);
+    ref_norm(&tm->tm_hour, &tm->tm_mday, 24);
+    ref_norm(&tm->tm_mon, &tm->tm_year, 12);
+    while (tm->tm_mday < 1) {
+        if (--tm->tm_mon < 0) {
+            tm->tm_mon = 11;
+            tm->tm_year--;
+        }
+        tm->tm_mday += ref_mdays(tm->tm_year, tm->tm_mon);
+    }
+    while (tm->tm_mday > ref_mdays(tm->tm_year, tm->tm_mon)) {
+        tm->tm_mday -= ref_mdays(tm->tm_year, tm->tm_mon);
+        if (++tm->tm_mon > 11) {
+            tm->tm_mon = 0;
+            tm->tm_year++;
+        }
+    }
+    tm->tm_yday = tm->tm_mday - 1;
+    for (m = 0; m < tm->tm_mon; m++)
+        tm->tm_yday += ref_mdays(tm->tm_year, m);
+    for (y = 70; y < tm->tm_year; y++)
+        days += 365 + ref_isleap(y);
+    for (y = 69; y >= tm->tm_year; y--)
+        days -= 365 + ref_isleap(y);
+    days += tm->tm_yday;
+    tm->tm_wday = (int)(((days + 4) % 7 + 7) % 7);
+    tm->tm_isdst = 0;
+    return days * 86400 + tm->tm_hour * 3600 + tm->tm_min * 60 + tm->tm_sec;
+}
+
+static bool
+tm_equal(const struct tm *a, const struct tm *b)
+{
+    return a->tm_sec == b->tm_sec && a->tm_min == b->tm_min && a->tm_hour == b->tm_hour
+        && a->tm_mday == b->tm_mday && a->tm_mon == b->tm_mon && a->tm_year == b->tm_year
+        && a->tm_wday == b->tm_wday && a->tm_yday == b->tm_yday && a->tm_isdst == b->tm_isdst;
+}
+
+static void
+print_tm(const char *label, const struct tm *tm)
+{
+    printf("    %s: %d-%d-%d %d:%d:%d wday %d yday %d isdst %d\n", label, tm->tm_year, tm->tm_mon,
+           tm->tm_mday, tm->tm_hour, tm->tm_min, tm->tm_sec, tm->tm_wday, tm->tm_yday,
+           tm->tm_isdst);
+}
+
+static const char *zones[] = {
+    "GMT0",
+    "EST5EDT",
+    "CET-1CEST,M3.5.0,M10.5.0/3",
+    "<+1030>-10:30<+11>-11,M10.1.0,M4.1.0",
+};
+
+#define NUM_ZONES (sizeof(zones) / sizeof(zones[0]))
+
+int
+main(void)
+{
+    int       i;
+    unsigned  z;
+    int       ret = 0;
+    struct tm got, want;
+
+    for (i = 0; i < NUM_TEST; i++) {
+        memset(&tests[i], 0, sizeof(tests[i]));
+        if (i % 4 == 0) {
+            /* wildly denormalized */
+            tests[i].tm_sec = rand_range(-100000, 100000);
+            tests[i].tm_min = rand_range(-10000, 10000);
+            tests[i].tm_hour = rand_range(-1000, 1000);
+            tests[i].tm_mday = rand_range(-5000, 5000);
+            tests[i].tm_mon = rand_range(-100, 100);
+            tests[i].tm_year = rand_range(-2000, 2000);
+        } else {
+            /* normalized timestamps, like parsed log entries */
+            tests[i].tm_sec = rand_range(0, 59);
+            tests[i].tm_min = rand_range(0, 59);
+            tests[i].tm_hour = rand_range(0, 23);
+            tests[i].tm_mon = rand_range(0, 11);
+            tests[i].tm_mday = rand_range(1, 28);
+            tests[i].tm_year = rand_range(0, 200);
+        }
+        tests[i].tm_isdst = -1;
+    }
+
+    for (i = 0; i < NUM_TEST; i++) {
+        long long want_t;
+        time_t    got_t;
+
+        got = want = tests[i];
+        want_t = ref_timegm(&want);
+        got_t = timegm(&got);
+        if (sizeof(time_t) < sizeof(long long) && (long long)(time_t)want_t != want_t)
+            continue;
+        if ((long long)got_t != want_t || !tm_equal(&got, &want)) {
+            printf("timegm %d: got %lld want %lld\n", i, (long long)got_t, want_t);
+            print_tm("got ", &got);
+            print_tm("want", &want);
+            ret = 1;
+        }
+    }
+
+    /* mktime must agree with localtime in every zone */
+    for (z = 0; z < NUM_ZONES; z++) {
+        setenv("TZ", zones[z], 1);
+        tzset();
+        for (i = 0; i < NUM_TEST; i++) {
+            struct tm *ptm;
+            time_t     t;
+
+            got = tests[i];
+            t = mktime(&got);
+            /* skip times which fall in the DST overlap */
+            if (t == (time_t)-1 || got.tm_isdst < 0)
+                continue;
+            ptm = localtime(&t);
+            if (!ptm) {
+                printf("mktime %s %d: localtime failed\n", zones[z], i);
+                ret = 1;
+                continue;
+            }
+            want = *ptm;
+            /* times inside the DST gap are shifted by mktime */
+            if (want.tm_isdst == got.tm_isdst && !tm_equal(&want, &got)) {
+                printf("mktime %s %d: %lld\n", zones[z], i, (long long)t);
+                print_tm("mktime   ", &got);
+                print_tm("localtime", &want);
+                ret = 1;
+            }
+        }
+    }
+
+#ifndef NO_NEWLIB
+    /* tzset publishes timezone, daylight and tzname even when TZ hasn't changed */
+    setenv("TZ", zones[1], 1);
+    tzset();
+    timezone = 0;
+    daylight = 0;
+    tzname[0][0] = 'X';
+    tzset();
+    if (timezone != 5 * 60 * 60 || !daylight || strcmp(tzname[0], "EST") != 0) {
+        printf("tzset: timezone %ld daylight %d tzname %s after reset\n", (long)timezone,
+               daylight, tzname[0]);
+        ret = 1;
+    }
+#endif
+
+#ifdef MKTIME_BENCH
+    {
+        int       b;
+        clock_t   start;
+        double    t_ref, t_new, t_env;
+        char      alt_zone[64];
+        long long sum = 0;
+
+        start = clock();
+        for (b = 0; b < NUM_BENCH; b++)
+            for (i = 0; i < NUM_TEST; i++) {
+                want = tests[i];
+                sum += ref_timegm(&want);
+            }
+        t_ref = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+        start = clock();
+        for (b = 0; b < NUM_BENCH; b++)
+            for (i = 0; i < NUM_TEST; i++) {
+                got = tests[i];
+                sum -= timegm(&got);
+            }
+        t_new = (double)(clock() - start) / CLOCKS_PER_SEC;
+        printf("timegm: reference %gs, timegm %gs for %d conversions\n", t_ref, t_new,
+               NUM_BENCH * NUM_TEST);
+
+        /*
+         * For a baseline, make tzset parse TZ on every call by switching
+         * between two spellings of the same zone, less the cost of the
+         * setenv calls themselves
+         */
+        snprintf(alt_zone, sizeof(alt_zone), ":%s", zones[NUM_ZONES - 1]);
+        start = clock();
+        for (b = 0; b < NUM_BENCH; b++)
+            for (i = 0; i < NUM_TEST; i++)
+                setenv("TZ", (i & 1) ? alt_zone : zones[NUM_ZONES - 1], 1);
+        t_env = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+        start = clock();
+        for (b = 0; b < NUM_BENCH; b++)
+            for (i = 0; i < NUM_TEST; i++) {
+                setenv("TZ", (i & 1) ? alt_zone : zones[NUM_ZONES - 1], 1);
+                got = tests[i];
+                sum += mktime(&got);
+            }
+        t_ref = (double)(clock() - start) / CLOCKS_PER_SEC - t_env;
+
+        setenv("TZ", zones[NUM_ZONES - 1], 1);
+        start = clock();
+        for (b = 0; b < NUM_BENCH; b++)
+            for (i = 0; i < NUM_TEST; i++) {
+                got = tests[i];
+                sum += mktime(&got);
+            }
+        t_new = (double)(clock() - start) / CLOCKS_PER_SEC;
+        printf("mktime (%s): parsing TZ %gs, cached TZ %gs for %d conversions\n",
+               zones[NUM_ZONES - 1], t_ref, t_new, NUM_BENCH * NUM_TEST);
+
+        (void)sum;
+    }
+#endif
+    return ret;
+}
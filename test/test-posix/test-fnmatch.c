@@ -33,6 +33,7 @@
  * OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#define _GNU_SOURCE
 #include <fnmatch.h>
 #include <locale.h>
 #include <stddef.h>
@@ -49,6 +50,73 @@ n(char const *pattern, char const *string, int flags)
     return fnmatch(pattern, string, flags) == FNM_NOMATCH;
 }
 
+#ifndef NO_NEWLIB
+static const struct {
+    const char *pattern;
+    const char *string;
+    int         flags;
+    int         result;
+} compiled_tests[] = {
+    { "*.C",          "x.c",       FNM_CASEFOLD,                    0 },
+    { "*.C",          "x.c",       0,                               FNM_NOMATCH },
+    { "*.C",          "X.C",       FNM_CASEFOLD,                    0 },
+    { "[a/]",         "a",         0,                               0 },
+    { "[a/]",         "a",         FNM_PATHNAME,                    FNM_NOMATCH },
+    { "*/b*",         "a/bc",      FNM_PATHNAME,                    0 },
+    { "*b",           "a/b",       FNM_PATHNAME,                    FNM_NOMATCH },
+    { "*[0-9]?\\*x",  "ab12*x",    0,                               0 },
+    { "*/*",          "a/.b",      FNM_PATHNAME | FNM_PERIOD,       FNM_NOMATCH },
+    { "[[:alnum:]]",  "a",         0,                               0 },
+    { "[!a-z]x*",     "Bxyz",      0,                               0 },
+    { "a*b*c",        "aXbYbZc",   0,                               0 },
+    { "a*b*c",        "aXbYbZ",    0,                               FNM_NOMATCH },
+    { ".*",           ".profile",  FNM_PERIOD,                      0 },
+    { "*",            ".profile",  FNM_PERIOD,                      FNM_NOMATCH },
+    { "dir/*",        "dir/sub/",  FNM_PATHNAME | FNM_LEADING_DIR,  0 },
+};
+
+#define NUM_COMPILED_TESTS (sizeof(compiled_tests) / sizeof(compiled_tests[0]))
+
+/*
+ * fnmatch must give the same answer after a pattern has been used
+ * often enough to be cached, and so must the compiled pattern. The
+ * flags are part of the cache key.
+ */
+static int
+check_compiled(void)
+{
+    unsigned   t;
+    int        r, want, ret = 0;
+    fnmatch_t *fp;
+
+    for (t = 0; t < NUM_COMPILED_TESTS; t++) {
+        const char *pattern = compiled_tests[t].pattern;
+        const char *string = compiled_tests[t].string;
+        int         flags = compiled_tests[t].flags;
+
+        want = compiled_tests[t].result;
+        fp = fnmatch_compile(pattern, flags);
+        if (!fp) {
+            printf("fnmatch_compile '%s' failed\n", pattern);
+            ret = 1;
+            continue;
+        }
+        if (fnmatch_exec(fp, string) != want) {
+            printf("fnmatch_exec '%s' '%s' %#x failed\n", pattern, string, flags);
+            ret = 1;
+        }
+        fnmatch_free(fp);
+        for (r = 0; r < 4; r++) {
+            if (fnmatch(pattern, string, flags) != want) {
+                printf("fnmatch '%s' '%s' %#x failed on call %d\n", pattern, string, flags, r);
+                ret = 1;
+            }
+        }
+    }
+    return ret;
+}
+#endif
+
 static int
 fail(int val, int line)
 {
@@ -115,6 +183,10 @@ main(void)
     /* This test fails on FreeBSD 13.2, NetBSD 10.0, Cygwin 3.4.6.  */
     if (!y("[[:alnum:]]", "a", 0))
         result |= fail(8, __LINE__);
+#ifndef NO_NEWLIB
+    if (check_compiled())
+        result |= fail(1, __LINE__);
+#endif
     /* ==== End of tests in the "C" locale ==== */
     /* ==== Start of tests that require a specific locale ==== */
     /* This test fails on Solaris 11.4.  */
@@ -182,6 +182,35 @@ main(void)
         ret = 1;
     }
 
+    /* Every entry returned by getgrent must be found by name and by id */
+    setgrent();
+    while ((grp_ret = getgrent()) != NULL) {
+        static char  lookup_buf[BUFSIZ];
+        struct group lookup, *lookup_ret;
+
+        if (getgrnam_r(grp_ret->gr_name, &lookup, lookup_buf, sizeof(lookup_buf), &lookup_ret) != 0
+            || !lookup_ret || strcmp(lookup_ret->gr_name, grp_ret->gr_name) != 0) {
+            printf("getgrnam_r didn't find '%s'\n", grp_ret->gr_name);
+            ret = 1;
+        }
+        if (getgrgid_r(grp_ret->gr_gid, &lookup, lookup_buf, sizeof(lookup_buf), &lookup_ret) != 0
+            || !lookup_ret || lookup_ret->gr_gid != grp_ret->gr_gid) {
+            printf("getgrgid_r didn't find %ld\n", (long)grp_ret->gr_gid);
+            ret = 1;
+        }
+    }
+
+    {
+        static char  lookup_buf[BUFSIZ];
+        struct group lookup, *lookup_ret = &lookup;
+
+        if (getgrnam_r("no such group", &lookup, lookup_buf, sizeof(lookup_buf), &lookup_ret) != 0
+            || lookup_ret != NULL) {
+            printf("getgrnam_r found a missing name\n");
+            ret = 1;
+        }
+    }
+
     endgrent();
 
 #endif
@@ -166,6 +166,35 @@ main(void)
         ret = 1;
     }
 
+    /* Every entry returned by getpwent must be found by name and by id */
+    setpwent();
+    while ((pwd_ret = getpwent()) != NULL) {
+        static char   lookup_buf[BUFSIZ];
+        struct passwd lookup, *lookup_ret;
+
+        if (getpwnam_r(pwd_ret->pw_name, &lookup, lookup_buf, sizeof(lookup_buf), &lookup_ret) != 0
+            || !lookup_ret || strcmp(lookup_ret->pw_name, pwd_ret->pw_name) != 0) {
+            printf("getpwnam_r didn't find '%s'\n", pwd_ret->pw_name);
+            ret = 1;
+        }
+        if (getpwuid_r(pwd_ret->pw_uid, &lookup, lookup_buf, sizeof(lookup_buf), &lookup_ret) != 0
+            || !lookup_ret || lookup_ret->pw_uid != pwd_ret->pw_uid) {
+            printf("getpwuid_r didn't find %ld\n", (long)pwd_ret->pw_uid);
+            ret = 1;
+        }
+    }
+
+    {
+        static char   lookup_buf[BUFSIZ];
+        struct passwd lookup, *lookup_ret = &lookup;
+
+        if (getpwnam_r("no such user", &lookup, lookup_buf, sizeof(lookup_buf), &lookup_ret) != 0
+            || lookup_ret != NULL) {
+            printf("getpwnam_r found a missing name\n");
+            ret = 1;
+        }
+    }
+
     endpwent();
 
 #endif
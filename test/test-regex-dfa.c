@@ -0,0 +1,215 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent <agent@local>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Run a handful of log-filter style patterns over generated log lines,
+ * check the number of matching lines against known values. Most of
+ * these patterns are handled by the cached DFA in regexec; the last one
+ * uses a word boundary and runs on the NFA code. Where REG_LARGE is
+ * available, it selects the large-state matcher, which never uses the
+ * DFA, so the match offsets can be compared with the NFA. Define
+ * REGEX_BENCH to also report how long each pattern takes both ways.
+ */
+
+#define _DEFAULT_SOURCE
+#include <sys/types.h>
+#include <regex.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#define NUM_LINES 1000
+#define LINE_LEN  128
+#ifdef REGEX_BENCH
+#define NUM_BENCH 10
+#endif
+
+static char lines[NUM_LINES][LINE_LEN];
+
+static uint32_t seed = 0x12345678;
+
+static unsigned
+rand_below(unsigned n)
+{
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 8) % n;
+}
+
+static const char * const users[] = { "root", "admin", "alice", "bob", "www-data" };
+static const char * const daemons[] = { "sshd", "cron", "kernel", "systemd", "nginx" };
+
+#define NUSERS   (sizeof(users) / sizeof(users[0]))
+#define NDAEMONS (sizeof(daemons) / sizeof(daemons[0]))
+
+static void
+make_lines(void)
+{
+    int i;
+
+    for (i = 0; i < NUM_LINES; i++) {
+        char    *l = lines[i];
+        size_t   s = LINE_LEN;
+        int      n;
+        unsigned d = rand_below(NDAEMONS);
+
+        n = snprintf(l, s, "2026-10-%02u %02u:%02u:%02u host%u %s[%u]: ", 1 + rand_below(28),
+                     rand_below(24), rand_below(60), rand_below(60), rand_below(16), daemons[d],
+                     100 + rand_below(30000));
+        switch (rand_below(4)) {
+        case 0:
+            snprintf(l + n, s - n, "Failed password for %s from 10.0.%u.%u port %u",
+                     users[rand_below(NUSERS)], rand_below(256), rand_below(256),
+                     rand_below(4) ? 1024 + rand_below(60000) : 22);
+            break;
+        case 1:
+            snprintf(l + n, s - n, "Accepted publickey for %s from 192.168.%u.%u port %u",
+                     users[rand_below(NUSERS)], rand_below(256), rand_below(256),
+                     1024 + rand_below(60000));
+            break;
+        case 2:
+            snprintf(l + n, s - n, "%s: connection reset by peer", rand_below(8) ? "INFO" : "ERROR");
+            break;
+        default:
+            snprintf(l + n, s - n, "session opened for user %s by (uid=%u)",
+                     users[rand_below(NUSERS)], rand_below(2000));
+            break;
+        }
+    }
+}
+
+static const struct {
+    const char *pattern;
+    int         cflags;
+    int         matches;
+} tests[] = {
+    { "ERROR",                                                   REG_EXTENDED,              26 },
+    { "Failed password for (root|admin)",                        REG_EXTENDED,              106 },
+    { "^[0-9]{4}-[0-9]{2}-[0-9]{2} [0-9:]+ host[0-9]+ kernel",   REG_EXTENDED,              217 },
+    { "port (22|2222)$",                                         REG_EXTENDED,              22 },
+    { "[a-z]+\\[[0-9]+\\]: (accepted|failed)",                   REG_EXTENDED | REG_ICASE,  491 },
+    { "for [a-z-]+ from 10\\.0\\.1[0-9]*\\.",                    REG_EXTENDED | REG_NOSUB,  112 },
+#ifndef NO_NEWLIB
+    /* word boundaries are a BSD extension */
+    { "[[:<:]](bob|alice)[[:>:]]",                               REG_EXTENDED,              290 },
+#endif
+};
+
+#define NTESTS (sizeof(tests) / sizeof(tests[0]))
+
+int
+main(void)
+{
+    regex_t    re;
+    regmatch_t pm[2];
+    unsigned   t;
+    int        i, r, count, ret = 0;
+
+    make_lines();
+
+    for (t = 0; t < NTESTS; t++) {
+        r = regcomp(&re, tests[t].pattern, tests[t].cflags);
+        if (r != 0) {
+            printf("regcomp '%s' failed %d\n", tests[t].pattern, r);
+            ret = 1;
+            continue;
+        }
+
+        count = 0;
+        for (i = 0; i < NUM_LINES; i++)
+            if (regexec(&re, lines[i], 0, NULL, 0) == 0)
+                count++;
+        if (count != tests[t].matches) {
+            printf("'%s': %d matches, expected %d\n", tests[t].pattern, count, tests[t].matches);
+            ret = 1;
+        }
+
+        /* Locating the match must agree with the plain yes/no answer */
+        for (i = 0; i < NUM_LINES; i++) {
+            int yes = regexec(&re, lines[i], 0, NULL, 0) == 0;
+            r = regexec(&re, lines[i], 2, pm, 0);
+            if (yes != (r == 0)
+                || (r == 0 && !(tests[t].cflags & REG_NOSUB)
+                    && (pm[0].rm_so < 0 || pm[0].rm_eo < pm[0].rm_so
+                        || pm[0].rm_eo > (regoff_t)strlen(lines[i])))) {
+                printf("'%s': inconsistent result on '%s'\n", tests[t].pattern, lines[i]);
+                ret = 1;
+                break;
+            }
+        }
+
+#ifdef REG_LARGE
+        /* The DFA must find the same match as the NFA */
+        for (i = 0; i < NUM_LINES; i++) {
+            regmatch_t nfa[2];
+            int        rn;
+
+            r = regexec(&re, lines[i], 2, pm, 0);
+            rn = regexec(&re, lines[i], 2, nfa, REG_LARGE);
+            if (r != rn
+                || (r == 0 && !(tests[t].cflags & REG_NOSUB)
+                    && (pm[0].rm_so != nfa[0].rm_so || pm[0].rm_eo != nfa[0].rm_eo))) {
+                printf("'%s': DFA and NFA disagree on '%s'\n", tests[t].pattern, lines[i]);
+                ret = 1;
+                break;
+            }
+        }
+#endif
+
+#ifdef REGEX_BENCH
+        {
+            clock_t start = clock();
+            clock_t dfa_ticks, nfa_ticks = 0;
+
+            for (r = 0; r < NUM_BENCH; r++)
+                for (i = 0; i < NUM_LINES; i++)
+                    (void)regexec(&re, lines[i], 0, NULL, 0);
+            dfa_ticks = clock() - start;
+#ifdef REG_LARGE
+            start = clock();
+            for (r = 0; r < NUM_BENCH; r++)
+                for (i = 0; i < NUM_LINES; i++)
+                    (void)regexec(&re, lines[i], 0, NULL, REG_LARGE);
+            nfa_ticks = clock() - start;
+#endif
+            printf("%-56s %4d matches %8ld ticks (NFA %8ld)\n", tests[t].pattern, count,
+                   (long)dfa_ticks, (long)nfa_ticks);
+        }
+#endif
+        regfree(&re);
+    }
+    return ret;
+}
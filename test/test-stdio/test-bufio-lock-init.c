@@ -44,7 +44,7 @@ IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  * in any conforming lock implementation.
  *
  * The fix delegates to __bufio_lock_init(), which performs double-checked
- * locking under __LIBC_LOCK() so only one slot is ever allocated.
+ * locking under __SFP_LOCK() so only one slot is ever allocated.
  *
  * This test opens a fresh FILE (bf->lock == NULL), lines up NUM_THREADS
  * threads on a barrier so they all enter fprintf simultaneously, and
@@ -0,0 +1,252 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent <agent@local>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Count the system calls made by a fast-bufio stream. The stream is
+ * built with wrappers around read, write, lseek, pread, pwrite and
+ * writev so the test can check that large writes are merged with
+ * buffered data and that random reads skip lseek.
+ */
+
+#define _DEFAULT_SOURCE
+#include <stdio.h>
+#ifndef NO_NEWLIB
+#include <stdio-posix.h>
+#endif
+#include <string.h>
+#include <stdlib.h>
+#include <fcntl.h>
+
+#if defined(__PICOLIBC__) && defined(__FAST_BUFIO)
+
+#ifndef TEST_FILE_NAME
+#define TEST_FILE_NAME "bufio-syscalls-test-file"
+#endif
+
+#define BUF_SIZE   16
+#define SMALL_SIZE 10
+#define DATA_SIZE  210
+#define NSEEK      32
+
+#define check(condition, message)                    \
+    do {                                             \
+        if (!(condition)) {                          \
+            printf("%s: %s\n", message, #condition); \
+            exit(1);                                 \
+        }                                            \
+    } while (0)
+
+static const char file_name[] = TEST_FILE_NAME;
+
+static int n_read, n_write, n_lseek, n_pread, n_pwrite, n_writev;
+
+static ssize_t
+count_read(int fd, void *buf, size_t count)
+{
+    n_read++;
+    return read(fd, buf, count);
+}
+
+static ssize_t
+count_write(int fd, const void *buf, size_t count)
+{
+    n_write++;
+    return write(fd, buf, count);
+}
+
+static off_t
+count_lseek(int fd, off_t offset, int whence)
+{
+    n_lseek++;
+    return lseek(fd, offset, whence);
+}
+
+static ssize_t
+count_pread(int fd, void *buf, size_t count, off_t offset)
+{
+    n_pread++;
+    return pread(fd, buf, count, offset);
+}
+
+static ssize_t
+count_pwrite(int fd, const void *buf, size_t count, off_t offset)
+{
+    n_pwrite++;
+    return pwrite(fd, buf, count, offset);
+}
+
+static ssize_t
+count_writev(int fd, const struct iovec *iov, int iovcnt)
+{
+    n_writev++;
+    return writev(fd, iov, iovcnt);
+}
+
+static void
+reset_counts(void)
+{
+    n_read = n_write = n_lseek = n_pread = n_pwrite = n_writev = 0;
+}
+
+static void
+test_cleanup(void)
+{
+    remove(file_name);
+}
+
+static char
+pattern(off_t pos)
+{
+    return 'a' + pos % 26;
+}
+
+int
+main(void)
+{
+    char   data[DATA_SIZE];
+    char   buf[BUF_SIZE];
+    char   in[4];
+    off_t  pos;
+    int    fd;
+    int    i;
+    size_t j;
+
+    for (j = 0; j < sizeof(data); j++)
+        data[j] = pattern(j);
+
+    atexit(test_cleanup);
+    fd = open(file_name, O_RDWR | O_CREAT | O_TRUNC, 0666);
+    check(fd >= 0, "open");
+
+    struct __file_bufio bf
+        = FDEV_SETUP_BUFIO_VEC(fd, buf, BUF_SIZE, count_read, count_write, count_lseek,
+                               close, count_pread, count_pwrite, count_writev,
+                               __SRD | __SWR, 0);
+    FILE *f = &bf.xfile.cfile.file;
+
+    /* A small write stays in the buffer, the large one takes it along */
+    reset_counts();
+    check(fwrite(data, 1, SMALL_SIZE, f) == SMALL_SIZE, "small fwrite");
+    check(n_write + n_writev == 0, "small fwrite was buffered");
+    check(fwrite(data + SMALL_SIZE, 1, DATA_SIZE - SMALL_SIZE, f) == DATA_SIZE - SMALL_SIZE,
+          "large fwrite");
+    check(fflush(f) == 0, "fflush after write");
+    printf("write: %d writev, %d write (unmerged: 2 write)\n", n_writev, n_write);
+    check(n_writev == 1 && n_write == 0, "merged write");
+    check(ftell(f) == DATA_SIZE, "ftell after write");
+
+    /* Random reads; only the first seek needs lseek */
+    reset_counts();
+    for (i = 0; i < NSEEK; i++) {
+        pos = (i * 67) % (DATA_SIZE - sizeof(in));
+        check(fseek(f, pos, SEEK_SET) == 0, "fseek");
+        check(fread(in, 1, sizeof(in), f) == sizeof(in), "fread");
+        for (j = 0; j < sizeof(in); j++)
+            check(in[j] == pattern(pos + j), "read data");
+    }
+    printf("%d seeks: %d lseek, %d read, %d pread (lseek+read: %d)\n", NSEEK, n_lseek, n_read,
+           n_pread, 2 * NSEEK);
+    check(n_lseek <= 1, "lseek count");
+    check(n_read + n_pread <= NSEEK, "read count");
+
+    /* Writes after a lazy seek land at the stream position */
+    check(fseek(f, 3, SEEK_SET) == 0, "fseek before write");
+    check(fwrite("XYZ", 1, 3, f) == 3, "fwrite after seek");
+    check(fflush(f) == 0, "fflush after seek");
+    check(lseek(fd, 0, SEEK_CUR) == 6, "fd offset after fflush");
+
+    /* pread and pwrite leave the fd offset alone */
+    check(pread(fd, in, 3, 6) == 3 && memcmp(in, "ghi", 3) == 0, "pread at offset");
+    check(lseek(fd, 0, SEEK_CUR) == 6, "fd offset after pread");
+    check(pwrite(fd, "g", 1, 6) == 1, "pwrite at offset");
+    check(lseek(fd, 0, SEEK_CUR) == 6, "fd offset after pwrite");
+    check(fseek(f, 0, SEEK_SET) == 0, "fseek to start");
+    check(fread(data, 1, 8, f) == 8, "fread after write");
+    check(memcmp(data, "abcXYZgh", 8) == 0, "data after write");
+
+    check(fflush(f) == 0, "final fflush");
+    check(close(fd) == 0, "close");
+
+    /* Append-mode streams write at EOF even after a lazy seek */
+    f = fopen(file_name, "a+");
+    check(f != NULL, "fopen append");
+    check(fseek(f, 0, SEEK_SET) == 0, "fseek append");
+    check(fread(in, 1, 3, f) == 3, "fread append");
+    check(fseek(f, 3, SEEK_SET) == 0, "second fseek append");
+    check(fwrite("123", 1, 3, f) == 3, "fwrite append");
+    check(fflush(f) == 0, "fflush append");
+    check(fread(in, 1, 4, f) == 0, "fread at end append");
+    check(fseek(f, 0, SEEK_SET) == 0, "fseek to start append");
+    check(fread(data, 1, 8, f) == 8, "fread start append");
+    check(memcmp(data, "abcXYZgh", 8) == 0, "start after append");
+    check(fseek(f, DATA_SIZE, SEEK_SET) == 0, "fseek to end append");
+    check(fread(in, 1, 4, f) == 3, "fread end append");
+    check(memcmp(in, "123", 3) == 0, "data after append");
+    check(fclose(f) == 0, "fclose append");
+
+#ifdef __HAVE_FCNTL
+    /* Likewise for a stream on an fd opened with O_APPEND */
+    fd = open(file_name, O_RDWR | O_APPEND);
+    check(fd >= 0, "open append");
+    f = fdopen(fd, "r+");
+    check(f != NULL, "fdopen append");
+    check(fseek(f, 0, SEEK_SET) == 0, "fseek fdopen");
+    check(fseek(f, 3, SEEK_SET) == 0, "second fseek fdopen");
+    check(fwrite("456", 1, 3, f) == 3, "fwrite fdopen");
+    check(fflush(f) == 0, "fflush fdopen");
+    check(fread(in, 1, 4, f) == 0, "fread at end fdopen");
+    check(fseek(f, 0, SEEK_SET) == 0, "fseek to start fdopen");
+    check(fread(data, 1, 8, f) == 8, "fread start fdopen");
+    check(memcmp(data, "abcXYZgh", 8) == 0, "start after fdopen");
+    check(fseek(f, DATA_SIZE + 3, SEEK_SET) == 0, "fseek to end fdopen");
+    check(fread(in, 1, 4, f) == 3, "fread end fdopen");
+    check(memcmp(in, "456", 3) == 0, "data after fdopen");
+    check(fclose(f) == 0, "fclose fdopen");
+#endif
+
+    printf("success\n");
+    return 0;
+}
+
+#else
+
+int
+main(void)
+{
+    printf("skipping bufio syscall test\n");
+    return 77;
+}
+
+#endif
@@ -0,0 +1,154 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent <agent@local>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Tokenize a stream in place with __fpeek/__fconsume, using both a
+ * bufio stream with a tiny buffer and an fmemopen stream, and check
+ * that ungetc characters show up at the start of the window. Without
+ * fast-memstream, the fmemopen stream is read a byte at a time.
+ */
+
+#define _DEFAULT_SOURCE
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#ifdef __PICOLIBC__
+
+#define check(condition, message)                    \
+    do {                                             \
+        if (!(condition)) {                          \
+            printf("%s: %s\n", message, #condition); \
+            exit(1);                                 \
+        }                                            \
+    } while (0)
+
+static const char message[] = "alpha beta gamma delta epsilon";
+static size_t     read_pos;
+
+static ssize_t
+test_read(void *cookie, void *buf, size_t n)
+{
+    (void)cookie;
+    if (n > sizeof(message) - 1 - read_pos)
+        n = sizeof(message) - 1 - read_pos;
+    memcpy(buf, message + read_pos, n);
+    read_pos += n;
+    return n;
+}
+
+/* Reassemble the stream by walking the windows */
+static void
+check_stream(FILE *fp, const char *name)
+{
+    char        out[sizeof(message)];
+    size_t      pos = 0;
+    size_t      len;
+    const char *w;
+    int         c;
+    int         pushed = 0;
+
+    c = getc(fp);
+    check(c == 'a', name);
+    check(ungetc(c, fp) == c, name);
+
+    while ((w = __fpeek(fp, &len)) != NULL) {
+        check(len > 0, name);
+        check(pos + len < sizeof(out), name);
+        memcpy(out + pos, w, len);
+        pos += len;
+        check(__fconsume(fp, len) == 0, name);
+
+        /* push back a different character, which must come next */
+        if (!pushed && pos >= 8 && pos < sizeof(message) - 1) {
+            pushed = 1;
+            check(getc(fp) == message[pos], name);
+            check(ungetc('X', fp) == 'X', name);
+            w = __fpeek(fp, &len);
+            check(w != NULL && len == 1 && *w == 'X', name);
+            check(__fconsume(fp, 1) == 0, name);
+            out[pos] = message[pos];
+            pos++;
+        }
+    }
+    check(feof(fp), name);
+    check(!ferror(fp), name);
+    out[pos] = '\0';
+    check(strcmp(out, message) == 0, name);
+    check(__fconsume(fp, 1) != 0, name);
+
+    /* A failed consume leaves a pending ungetc character alone */
+    check(ungetc('Y', fp) == 'Y', name);
+    check(__fconsume(fp, 2) != 0, name);
+    check(getc(fp) == 'Y', name);
+}
+
+int
+main(void)
+{
+    char  buf[sizeof(message)];
+    FILE *fp;
+
+    fp = funopen(NULL, test_read, NULL, NULL, NULL);
+    check(fp != NULL, "funopen");
+    check(setvbuf(fp, NULL, _IOFBF, 4) == 0, "setvbuf");
+    check_stream(fp, "bufio");
+    fclose(fp);
+
+    memcpy(buf, message, sizeof(message));
+    fp = fmemopen(buf, sizeof(message) - 1, "r");
+    check(fp != NULL, "fmemopen");
+    check_stream(fp, "fmemopen");
+    fclose(fp);
+
+    /* Write-only streams have no read window */
+    char  *mem = NULL;
+    size_t len = 1;
+    fp = open_memstream(&mem, &len);
+    check(fp != NULL, "open_memstream");
+    check(__fpeek(fp, &len) == NULL && len == 0, "write-only stream");
+    fclose(fp);
+    free(mem);
+    return 0;
+}
+
+#else
+int
+main(void)
+{
+    printf("__fpeek only available on picolibc\n");
+    return 77;
+}
+#endif
@@ -0,0 +1,188 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent <agent@local>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#define _DEFAULT_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#ifndef TEST_FILE_NAME
+#define TEST_FILE_NAME "GETDELIM.TXT"
+#endif
+
+#define check(condition, message)                    \
+    do {                                             \
+        if (!(condition)) {                          \
+            printf("%s: %s\n", message, #condition); \
+            unlink(TEST_FILE_NAME);                  \
+            exit(1);                                 \
+        }                                            \
+    } while (0)
+
+/* Line lengths chosen to straddle the allocation and buffer sizes */
+static const size_t lengths[] = {
+    0, 1, 14, 15, 16, 17, 31, 32, 33, BUFSIZ - 1, BUFSIZ, BUFSIZ + 1, 3 * BUFSIZ + 7, 2, 100,
+};
+
+#define NLINES (sizeof(lengths) / sizeof(lengths[0]))
+
+static char
+line_char(size_t line, size_t pos)
+{
+    return 'a' + (char)((line * 7 + pos) % 26);
+}
+
+static void
+check_line(const char *got, size_t len, size_t line, int delim)
+{
+    size_t i;
+
+    for (i = 0; i < len; i++)
+        check(got[i] == line_char(line, i), "line contents");
+    check(got[len] == delim, "delimiter");
+}
+
+/* Read the test data back with getline, getdelim and fgets */
+static void
+check_read(FILE *f)
+{
+    char   *line = NULL;
+    size_t  n = 0;
+    ssize_t ret;
+    size_t  l, i;
+    char    small[40];
+
+    /* getline */
+    for (l = 0; l < NLINES; l++) {
+        ret = getline(&line, &n, f);
+        if (l != NLINES - 1) {
+            check(ret == (ssize_t)lengths[l] + 1, "getline length");
+            check_line(line, lengths[l], l, '\n');
+            check(line[ret] == '\0', "getline terminator");
+        } else {
+            check(ret == (ssize_t)lengths[l], "getline unterminated length");
+            check_line(line, lengths[l], l, '\0');
+        }
+        check(n > (size_t)ret, "getline size");
+    }
+    check(getline(&line, &n, f) == -1, "getline at EOF");
+    check(feof(f), "EOF flag");
+
+    /* getdelim with a delimiter which never appears returns the whole file */
+    rewind(f);
+    ret = getdelim(&line, &n, ':', f);
+    check(ret > 3 * BUFSIZ, "getdelim whole file");
+    check(line[ret] == '\0', "getdelim terminator");
+    check(getdelim(&line, &n, ':', f) == -1, "getdelim at EOF");
+
+    /* Pending ungetc is included in the line */
+    rewind(f);
+    check(getline(&line, &n, f) == 1, "getline empty line");
+    check(ungetc('X', f) == 'X', "ungetc");
+    ret = getline(&line, &n, f);
+    check(ret == 3 && line[0] == 'X' && line[2] == '\n', "getline after ungetc");
+    check(ungetc('\n', f) == '\n', "ungetc newline");
+    check(getline(&line, &n, f) == 1 && line[0] == '\n', "getline ungetc delimiter");
+
+    /* fgets with a buffer shorter than most lines */
+    rewind(f);
+    for (l = 0; l < NLINES; l++) {
+        size_t got = 0;
+        for (;;) {
+            check(fgets(small, sizeof(small), f) == small, "fgets");
+            i = strlen(small);
+            check(i < sizeof(small), "fgets length");
+            memcpy(line + got, small, i);
+            got += i;
+            if (i == 0 || small[i - 1] == '\n' || (l == NLINES - 1 && got == lengths[l]))
+                break;
+        }
+        if (l != NLINES - 1) {
+            check(got == lengths[l] + 1, "fgets line length");
+            check_line(line, lengths[l], l, '\n');
+        } else {
+            check(got == lengths[l], "fgets unterminated length");
+        }
+    }
+    check(fgets(small, sizeof(small), f) == NULL, "fgets at EOF");
+    check(fgets(small, 1, f) == small && small[0] == '\0', "fgets size one");
+
+    free(line);
+}
+
+int
+main(void)
+{
+    FILE  *f;
+    char  *data;
+    size_t size = 0;
+    size_t l, i;
+
+    for (l = 0; l < NLINES; l++)
+        size += lengths[l] + 1;
+    data = malloc(size);
+    check(data != NULL, "malloc");
+
+    size = 0;
+    for (l = 0; l < NLINES; l++) {
+        for (i = 0; i < lengths[l]; i++)
+            data[size++] = line_char(l, i);
+        /* Leave the last line unterminated */
+        if (l != NLINES - 1)
+            data[size++] = '\n';
+    }
+
+    f = fopen(TEST_FILE_NAME, "w");
+    check(f != NULL, "fopen for write");
+    check(fwrite(data, 1, size, f) == size, "fwrite");
+    check(fclose(f) == 0, "fclose");
+
+    /* Buffered file */
+    f = fopen(TEST_FILE_NAME, "r");
+    check(f != NULL, "fopen for read");
+    check_read(f);
+    fclose(f);
+
+    /* Memory stream */
+    f = fmemopen(data, size, "r");
+    check(f != NULL, "fmemopen");
+    check_read(f);
+    fclose(f);
+
+    free(data);
+    unlink(TEST_FILE_NAME);
+    printf("success\n");
+    return 0;
+}
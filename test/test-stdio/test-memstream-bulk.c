@@ -0,0 +1,152 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent <agent@local>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Exercise the bulk paths through memory streams: fwrite, fread,
+ * fputs and fprintf across buffer boundaries, ungetc before fread and
+ * open_memstream growth from a long series of appends.
+ */
+
+#define _DEFAULT_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define check(condition, message)                    \
+    do {                                             \
+        if (!(condition)) {                          \
+            printf("%s: %s\n", message, #condition); \
+            exit(1);                                 \
+        }                                            \
+    } while (0)
+
+#define CHUNK  "0123456789abcdef"
+#define CHUNKS 4096
+
+static char expect[(sizeof(CHUNK) - 1) * CHUNKS * 2 + 1];
+
+int
+main(void)
+{
+    char   small[16];
+    char   data[64];
+    FILE  *f;
+    char  *buf = NULL;
+    size_t len = 0;
+    size_t pos = 0;
+    int    i;
+
+#ifndef NO_NEWLIB
+    /*
+     * How writes are cut off at the end of an fmemopen buffer differs
+     * between implementations; these check picolibc's behavior.
+     */
+
+    /* fmemopen: writes stop at the end of the buffer */
+    memset(small, 'x', sizeof(small));
+    f = fmemopen(small, sizeof(small), "w");
+    check(f != NULL, "fmemopen");
+    check(fwrite("hello", 1, 5, f) == 5, "fwrite");
+    check(fputs(", world", f) >= 0, "fputs");
+    check(fwrite("abcdef", 2, 3, f) == 2, "fwrite past end");
+    fclose(f);
+    check(memcmp(small, "hello, worldabcd", 16) == 0, "fmemopen contents");
+
+    /* fmemopen: printf output is truncated at the end of the buffer */
+    f = fmemopen(small, sizeof(small), "w");
+    check(f != NULL, "fmemopen");
+    check(fprintf(f, "%d %s", 42, "is the answer!") < 0, "fprintf overflow");
+    fclose(f);
+    check(memcmp(small, "42 is the answer", 16) == 0, "fprintf contents");
+
+#endif
+
+    /* fmemopen: printf output is null terminated when it fits */
+    f = fmemopen(data, sizeof(data), "w");
+    check(f != NULL, "fmemopen");
+    check(fprintf(f, "%5d|%-4s|%c", 7, "ab", 'z') == 12, "fprintf");
+    fflush(f);
+    check(strcmp(data, "    7|ab  |z") == 0, "fprintf formatting");
+    fclose(f);
+
+    /* fmemopen: fread after ungetc, then a short read at the end */
+    strcpy(data, "The quick brown fox");
+    f = fmemopen(data, strlen(data), "r");
+    check(f != NULL, "fmemopen");
+    check(getc(f) == 'T', "getc");
+    check(ungetc('t', f) == 't', "ungetc");
+    memset(small, 0, sizeof(small));
+    check(fread(small, 1, 9, f) == 9, "fread");
+    check(memcmp(small, "the quick", 9) == 0, "fread contents");
+    check(fread(small, 4, 4, f) == 2, "fread short");
+    check(memcmp(small, " brown f", 8) == 0, "fread short contents");
+    check(feof(f), "fread eof");
+    fclose(f);
+
+    /* open_memstream: mix bulk and formatted output while growing */
+    f = open_memstream(&buf, &len);
+    check(f != NULL, "open_memstream");
+    for (i = 0; i < CHUNKS; i++) {
+        switch (i % 3) {
+        case 0:
+            check(fwrite(CHUNK, 1, sizeof(CHUNK) - 1, f) == sizeof(CHUNK) - 1, "fwrite");
+            break;
+        case 1:
+            check(fputs(CHUNK, f) >= 0, "fputs");
+            break;
+        case 2:
+            check(fprintf(f, "%s", CHUNK) == sizeof(CHUNK) - 1, "fprintf");
+            break;
+        }
+        memcpy(expect + pos, CHUNK, sizeof(CHUNK) - 1);
+        pos += sizeof(CHUNK) - 1;
+        check(fprintf(f, "%08x", i) == 8, "fprintf hex");
+        snprintf(expect + pos, 9, "%08x", i);
+        pos += 8;
+    }
+    fflush(f);
+    check(len == pos, "open_memstream length");
+    check(strcmp(buf, expect) == 0, "open_memstream contents");
+
+    /* open_memstream: overwrite after seeking back */
+    check(fseek(f, 4, SEEK_SET) == 0, "fseek");
+    check(fwrite("XY", 1, 2, f) == 2, "fwrite after seek");
+    fclose(f);
+    check(len == 6, "open_memstream length after seek");
+    check(memcmp(buf, "0123XY", 6) == 0, "open_memstream seek contents");
+    free(buf);
+
+    return 0;
+}
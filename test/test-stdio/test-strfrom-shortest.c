@@ -0,0 +1,189 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent <agent@local>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#define _DEFAULT_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#ifdef _HAS_IO_SHORTEST
+
+/* The '=' flag is a picolibc extension */
+#pragma GCC diagnostic ignored "-Wpragmas"
+#pragma GCC diagnostic ignored "-Wunknown-warning-option"
+#pragma GCC diagnostic ignored "-Wformat-extra-args"
+#pragma GCC diagnostic ignored "-Wformat"
+
+static const struct {
+    double      d;
+    const char *g, *e, *f;
+} dtests[] = {
+    { 0.0, "0", "0e+00", "0" },
+    { -0.0, "-0", "-0e+00", "-0" },
+    { 1.0, "1", "1e+00", "1" },
+    { 0.1, "0.1", "1e-01", "0.1" },
+    { 0.1 + 0.2, "0.30000000000000004", "3.0000000000000004e-01", "0.30000000000000004" },
+    { 1.0 / 3.0, "0.3333333333333333", "3.333333333333333e-01", "0.3333333333333333" },
+    { 100.0, "100", "1e+02", "100" },
+    { 123456789.0, "123456789", "1.23456789e+08", "123456789" },
+    { 1e16, "10000000000000000", "1e+16", "10000000000000000" },
+    { 1e21, "1e+21", "1e+21", "1000000000000000000000" },
+    { 0.0001, "0.0001", "1e-04", "0.0001" },
+    { 1e-5, "1e-05", "1e-05", "0.00001" },
+    { 5e-324, "5e-324", "5e-324", NULL },
+    { 1.7976931348623157e308, "1.7976931348623157e+308", "1.7976931348623157e+308", NULL },
+};
+
+static const struct {
+    float       f;
+    const char *g;
+} ftests[] = {
+    { 0.1f, "0.1" },
+    { 1.0f / 3.0f, "0.33333334" },
+    { 16777216.0f, "16777216" },
+    { 1e10f, "1e+10" },
+    { 1.4e-45f, "1e-45" },
+    { 3.4028235e38f, "3.4028235e+38" },
+};
+
+#define NDTESTS (sizeof(dtests) / sizeof(dtests[0]))
+#define NFTESTS (sizeof(ftests) / sizeof(ftests[0]))
+
+static int errors;
+
+static void
+check(const char *fmt, const char *got, const char *expect)
+{
+    if (strcmp(got, expect) != 0) {
+        printf("%s: got \"%s\" expect \"%s\"\n", fmt, got, expect);
+        errors++;
+    }
+}
+
+/* Count significant digits in a shortest-format string */
+static int
+sig_digits(const char *s)
+{
+    int n = 0, zeros = 0, lead = 1;
+
+    for (; *s && *s != 'e'; s++) {
+        if (*s < '0' || '9' < *s)
+            continue;
+        if (*s != '0') {
+            lead = 0;
+            zeros = 0;
+        } else {
+            zeros++;
+        }
+        if (!lead)
+            n++;
+    }
+    n -= zeros;
+    return n > 0 ? n : 1;
+}
+
+int
+main(void)
+{
+    char     buf[400], shorter[400];
+    unsigned i;
+    uint64_t x = 88172645463325252ULL;
+
+    for (i = 0; i < NDTESTS; i++) {
+        strfromd(buf, sizeof(buf), "%=g", dtests[i].d);
+        check("%=g", buf, dtests[i].g);
+        strfromd(buf, sizeof(buf), "%=e", dtests[i].d);
+        check("%=e", buf, dtests[i].e);
+        if (dtests[i].f) {
+            snprintf(buf, sizeof(buf), "%=f", dtests[i].d);
+            check("%=f", buf, dtests[i].f);
+        }
+    }
+    snprintf(buf, sizeof(buf), "[%=8g|%-=8g]", 2.5, 2.5);
+    check("width", buf, "[     2.5|2.5     ]");
+#ifdef _HAS_IO_POS_ARGS
+    snprintf(buf, sizeof(buf), "%2$=g %1$d", 7, 0.1);
+    check("positional", buf, "0.1 7");
+    snprintf(buf, sizeof(buf), "%2$d %1$=g", 0.1, 7);
+    check("positional", buf, "7 0.1");
+    snprintf(buf, sizeof(buf), "%2$d %1$-=5g|", 0.1, 7);
+    check("positional", buf, "7 0.1  |");
+#endif
+
+    for (i = 0; i < NFTESTS; i++) {
+        strfromf(buf, sizeof(buf), "%=g", ftests[i].f);
+        check("strfromf %=g", buf, ftests[i].g);
+    }
+
+    /* Random values must read back exactly and need every digit */
+    for (i = 0; i < 100000; i++) {
+        double d;
+        int    n;
+
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        memcpy(&d, &x, sizeof(d));
+        if (d != d || d - d != 0)
+            continue;
+        strfromd(buf, sizeof(buf), "%=g", d);
+        if (strtod(buf, NULL) != d) {
+            printf("round trip failed %a -> %s\n", d, buf);
+            errors++;
+        }
+        n = sig_digits(buf);
+        if (n > 1) {
+            snprintf(shorter, sizeof(shorter), "%.*g", n - 1, d);
+            if (strtod(shorter, NULL) == d) {
+                printf("not shortest %s (%s)\n", buf, shorter);
+                errors++;
+            }
+        }
+    }
+    if (errors)
+        printf("%d errors\n", errors);
+    return errors != 0;
+}
+
+#else
+
+int
+main(void)
+{
+    printf("shortest float formatting not supported\n");
+    return 77;
+}
+
+#endif
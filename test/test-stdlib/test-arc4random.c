@@ -0,0 +1,202 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent <agent@local>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Check the arc4random keystream against the scalar ChaCha code, and
+ * the per-thread generator state when that is enabled. The library
+ * source is included directly to reach its static functions.
+ */
+
+#ifdef NO_NEWLIB
+int
+main(void)
+{
+    return 77;
+}
+#else
+
+#include "../../libc/stdlib/arc4random.c"
+#include <stdio.h>
+#ifdef __THREAD_LOCAL_STORAGE_API
+#include <picotls.h>
+#endif
+
+/* ChaCha20 with an all-zero key and IV, block 0 */
+static const u8 zero_block[32] = {
+    0x76, 0xb8, 0xe0, 0xad, 0xa0, 0xf1, 0x3d, 0x90, 0x40, 0x5d, 0x6a, 0xe5, 0x53, 0x86, 0xbd, 0x28,
+    0xbd, 0xd2, 0x19, 0xb8, 0xa0, 0x8d, 0xed, 0x1a, 0xa8, 0x36, 0xef, 0xcc, 0x8b, 0x77, 0x0d, 0xc7,
+};
+
+/* Starting block counters, including ones where word 12 wraps into word 13 */
+static const uint64_t counters[] = {
+    0, 1, 0xfffffff0ULL, 0xfffffffdULL, 0xffffffffULL, 0x1fffffffeULL, 0xfffffffffffffffdULL,
+};
+
+static const size_t lengths[] = {
+    0, 1, 63, 64, 65, 255, 256, 257, 511, 512, 600, 1023, 1024, RSBUFSZ,
+};
+
+#define NUM_COUNTERS (sizeof(counters) / sizeof(counters[0]))
+#define NUM_LENGTHS  (sizeof(lengths) / sizeof(lengths[0]))
+
+static u8 got[RSBUFSZ], want[RSBUFSZ];
+
+static uint32_t seed = 0x12345678;
+
+static u8
+rand_byte(void)
+{
+    seed = seed * 1103515245 + 12345;
+    return seed >> 16;
+}
+
+static int
+check_keystream(void)
+{
+    chacha_ctx vec, ref;
+    u8         key[KEYSZ], iv[IVSZ];
+    unsigned   k, c, l, i;
+    int        ret = 0;
+
+    memset(key, 0, sizeof(key));
+    memset(iv, 0, sizeof(iv));
+    chacha_keysetup(&vec, key, KEYSZ * 8);
+    chacha_ivsetup(&vec, iv);
+    chacha_keystream(&vec, got, RSBUFSZ);
+    if (memcmp(got, zero_block, sizeof(zero_block)) != 0) {
+        printf("keystream for the zero key is wrong\n");
+        ret = 1;
+    }
+
+    for (k = 0; k < 4; k++) {
+        for (i = 0; i < KEYSZ; i++)
+            key[i] = rand_byte();
+        for (i = 0; i < IVSZ; i++)
+            iv[i] = rand_byte();
+        for (c = 0; c < NUM_COUNTERS; c++) {
+            for (l = 0; l < NUM_LENGTHS; l++) {
+                chacha_keysetup(&vec, key, KEYSZ * 8);
+                chacha_ivsetup(&vec, iv);
+                vec.input[12] = (u32)counters[c];
+                vec.input[13] = (u32)(counters[c] >> 32);
+                ref = vec;
+
+                memset(got, 0, sizeof(got));
+                memset(want, 0, sizeof(want));
+                chacha_keystream(&vec, got, lengths[l]);
+                chacha_encrypt_bytes(&ref, want, want, lengths[l]);
+                if (memcmp(got, want, lengths[l]) != 0
+                    || memcmp(vec.input, ref.input, sizeof(vec.input)) != 0) {
+                    printf("keystream mismatch: key %u counter %#llx length %zu\n", k,
+                           (unsigned long long)counters[c], lengths[l]);
+                    ret = 1;
+                }
+            }
+        }
+    }
+    return ret;
+}
+
+#if defined(__ARC4RANDOM_TLS) && defined(__THREAD_LOCAL_STORAGE) \
+    && defined(__THREAD_LOCAL_STORAGE_API)
+extern char __tls_base[];
+
+/*
+ * Switching to a fresh TLS block stands in for a new thread: it must
+ * start with an unseeded generator and leave the first one alone.
+ */
+static int
+check_tls_state(void)
+{
+    size_t   have;
+    uint32_t a, b;
+    void    *tls = aligned_alloc(_tls_align(), _tls_size());
+    int      ret = 0;
+
+    if (!tls) {
+        printf("TLS allocation failed\n");
+        return 1;
+    }
+    (void)arc4random();
+    have = arc4random_rs.rs_have;
+
+    _init_tls(tls);
+    _set_tls(tls);
+    if (arc4random_init || arc4random_rs.rs_have != 0) {
+        printf("new TLS block has a seeded generator\n");
+        ret = 1;
+    }
+    a = arc4random();
+    b = arc4random();
+    if (!arc4random_init || a == b) {
+        printf("generator in new TLS block didn't seed\n");
+        ret = 1;
+    }
+    _set_tls(__tls_base);
+    free(tls);
+
+    if (!arc4random_init || arc4random_rs.rs_have != have) {
+        printf("generator state changed by another TLS block\n");
+        ret = 1;
+    }
+    return ret;
+}
+#endif
+
+int
+main(void)
+{
+    int      ret = 0;
+    uint32_t a, b;
+
+    ret |= check_keystream();
+
+    a = arc4random();
+    b = arc4random();
+    arc4random_buf(got, sizeof(got));
+    arc4random_buf(want, sizeof(want));
+    if (a == b || memcmp(got, want, sizeof(got)) == 0) {
+        printf("arc4random repeated itself\n");
+        ret = 1;
+    }
+
+#if defined(__ARC4RANDOM_TLS) && defined(__THREAD_LOCAL_STORAGE) \
+    && defined(__THREAD_LOCAL_STORAGE_API)
+    ret |= check_tls_state();
+#endif
+    return ret;
+}
+
+#endif
@@ -0,0 +1,110 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent <agent@local>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Exit handlers run in reverse order of registration, and a handler
+ * registered while handlers are running is called before any which
+ * were registered earlier and haven't run yet (C11 7.22.4.4).
+ */
+
+#include <stdlib.h>
+#include <unistd.h>
+#include <stdio.h>
+#include <string.h>
+
+static char order[16];
+static int  norder;
+
+static void
+record(char c)
+{
+    if (norder < (int)sizeof(order) - 1)
+        order[norder++] = c;
+}
+
+static void
+check(void)
+{
+    static const char expect[] = "HNba";
+
+    record('\0');
+    if (norder != (int)sizeof(expect) || strcmp(order, expect) != 0) {
+        printf("handler order \"%s\", expected \"%s\"\n", order, expect);
+        _exit(1);
+    }
+    _exit(0);
+}
+
+static void
+nested(void)
+{
+    record('N');
+}
+
+static void
+b(void)
+{
+    record('b');
+}
+
+static void
+a(void)
+{
+    record('a');
+}
+
+static void
+last(void)
+{
+    record('H');
+    if (atexit(nested) != 0) {
+        printf("atexit during exit failed\n");
+        _exit(1);
+    }
+}
+
+int
+main(void)
+{
+    if (atexit(check) != 0 || atexit(a) != 0 || atexit(b) != 0
+        || atexit(last) != 0) {
+        printf("atexit failed\n");
+        return 1;
+    }
+    /* Need to call exit explicitly so that native
+     * tests (which use glibc crt0) get picolibc exit
+     */
+    exit(2);
+}
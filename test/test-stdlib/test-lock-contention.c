@@ -0,0 +1,197 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent <agent@local>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Check that unrelated subsystems don't contend on the global libc
+ * lock, and that getenv takes the environment lock shared.
+ *
+ * With the global lock held, worker threads run malloc, getenv,
+ * arc4random, localtime_r and atexit; all of these use their own
+ * locks, so the workers must finish. Then, with the environment lock
+ * held shared, the workers run getenv again, which must not block on
+ * the outstanding reader. Finally a writer thread races setenv against
+ * the readers to check that lookups never miss a variable while it is
+ * being replaced. The value itself isn't checked: setenv may overwrite
+ * it in place once getenv has returned.
+ *
+ * This relies on the per-subsystem locks and reader/writer hooks
+ * defined in native-locks.c.
+ */
+
+#define _DEFAULT_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <stdatomic.h>
+#include <sys/lock.h>
+
+#define NUM_THREADS 8
+#define ITERS       1000
+#define TIMEOUT     10
+
+int  start_threads(int n, void *(*func)(void *), void *arg);
+int  stop_threads(void);
+int  stop_threads_timeout(int seconds);
+void sync_threads(void);
+
+#if !defined(NO_NEWLIB) && !defined(__SINGLE_THREAD)
+
+static atomic_int failures;
+
+static void
+exit_func(void)
+{
+}
+
+static void *
+subsys_thread(void *arg)
+{
+    int    i;
+    time_t t = 0;
+
+    (void)arg;
+    sync_threads();
+    for (i = 0; i < ITERS; i++) {
+        void     *p = malloc((size_t)i + 1);
+        struct tm tm;
+
+        if (!p)
+            atomic_fetch_add(&failures, 1);
+        free(p);
+        if (!getenv("LOCK_TEST"))
+            atomic_fetch_add(&failures, 1);
+        (void)arc4random();
+        if (!localtime_r(&t, &tm))
+            atomic_fetch_add(&failures, 1);
+    }
+    (void)atexit(exit_func);
+    return NULL;
+}
+
+static void *
+getenv_thread(void *arg)
+{
+    int i;
+
+    (void)arg;
+    sync_threads();
+    for (i = 0; i < ITERS; i++) {
+        if (!getenv("LOCK_TEST"))
+            atomic_fetch_add(&failures, 1);
+    }
+    return NULL;
+}
+
+static void *
+setenv_thread(void *arg)
+{
+    int i;
+
+    (void)arg;
+    sync_threads();
+    for (i = 0; i < ITERS; i++) {
+        if (setenv("LOCK_TEST", (i & 1) ? "short" : "a much longer value", 1) != 0)
+            atomic_fetch_add(&failures, 1);
+        if (setenv("LOCK_TEST_OTHER", "x", 1) != 0 || unsetenv("LOCK_TEST_OTHER") != 0)
+            atomic_fetch_add(&failures, 1);
+    }
+    return NULL;
+}
+
+/* Run 'func' on NUM_THREADS threads, reporting whether they all finished in time */
+static int
+run_threads(const char *name, void *(*func)(void *))
+{
+    int ret = 0;
+
+    if (start_threads(NUM_THREADS, func, NULL) != 0) {
+        printf("%s: start_threads failed\n", name);
+        return 1;
+    }
+    sync_threads();
+    if (stop_threads_timeout(TIMEOUT) != 0) {
+        printf("%s: threads blocked\n", name);
+        ret = 1;
+    }
+    return ret;
+}
+
+int
+main(void)
+{
+    int ret = 0;
+
+    if (setenv("LOCK_TEST", "short", 1) != 0) {
+        printf("setenv failed\n");
+        return 1;
+    }
+
+    /* Subsystems must not need the global lock */
+    __LIBC_LOCK();
+    ret |= run_threads("global lock held", subsys_thread);
+    __LIBC_UNLOCK();
+    stop_threads();
+
+    /* Readers must share the environment lock */
+    __ENV_LOCK_SHARED();
+    ret |= run_threads("environment read lock held", getenv_thread);
+    __ENV_UNLOCK_SHARED();
+    stop_threads();
+
+    /* The main thread writes while the workers read */
+    if (start_threads(NUM_THREADS, getenv_thread, NULL) == 0) {
+        setenv_thread(NULL);
+        stop_threads();
+    } else {
+        ret = 1;
+    }
+
+    if (failures) {
+        printf("%d failures\n", failures);
+        ret = 1;
+    }
+    return ret;
+}
+
+#else
+
+int
+main(void)
+{
+    printf("Requires picolibc with native locking, test skipped\n");
+    return 77;
+}
+
+#endif
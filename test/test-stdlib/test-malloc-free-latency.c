@@ -0,0 +1,149 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent <agent@local>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Fragment the heap by freeing every other block, then free the rest
+ * in random order so that each free merges with both neighbours.
+ * Check that the data in the remaining blocks survives, that the
+ * heap ends up back in one piece and report how long the frees took.
+ * The address-ordered free list walks past every free fragment on
+ * each free; with malloc-boundary-tag each free is constant time.
+ */
+
+#define _DEFAULT_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <malloc.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#ifndef NUM_BLOCK
+#define NUM_BLOCK 1024
+#endif
+#define MIN_SIZE 8
+#define MAX_SIZE 72
+
+static uint8_t *blocks[NUM_BLOCK];
+static size_t   sizes[NUM_BLOCK];
+static int      order[NUM_BLOCK];
+
+static uint32_t seed = 0x12345678;
+
+static unsigned
+rand_below(unsigned n)
+{
+    seed = seed * 1103515245 + 12345;
+    return (seed >> 16) % n;
+}
+
+static int
+check_block(int i)
+{
+    size_t j;
+
+    for (j = 0; j < sizes[i]; j++)
+        if (blocks[i][j] != (uint8_t)i) {
+            printf("block %d corrupted at %zu\n", i, j);
+            return 1;
+        }
+    return 0;
+}
+
+int
+main(void)
+{
+#ifdef __PICOLIBC__
+    struct mallinfo start_info, info;
+#endif
+    clock_t         start, odd_ticks, even_ticks;
+    int             num_block, num_even;
+    int             i, j, t;
+    int             ret = 0;
+
+#ifdef __PICOLIBC__
+    start_info = mallinfo();
+#endif
+
+    for (num_block = 0; num_block < NUM_BLOCK; num_block++) {
+        sizes[num_block] = MIN_SIZE + rand_below(MAX_SIZE - MIN_SIZE);
+        blocks[num_block] = malloc(sizes[num_block]);
+        if (!blocks[num_block])
+            break;
+        memset(blocks[num_block], num_block, sizes[num_block]);
+    }
+
+    /* Leave a busy block between each free one */
+    start = clock();
+    for (i = 1; i < num_block; i += 2)
+        free(blocks[i]);
+    odd_ticks = clock() - start;
+
+    num_even = 0;
+    for (i = 0; i < num_block; i += 2) {
+        ret += check_block(i);
+        order[num_even++] = i;
+    }
+    for (i = 0; i < num_even - 1; i++) {
+        j = i + rand_below(num_even - i);
+        t = order[i];
+        order[i] = order[j];
+        order[j] = t;
+    }
+
+    /* Now each free merges with the free blocks on either side */
+    start = clock();
+    for (i = 0; i < num_even; i++)
+        free(blocks[order[i]]);
+    even_ticks = clock() - start;
+
+#ifdef __PICOLIBC__
+    info = mallinfo();
+    if (info.ordblks > start_info.ordblks + 1) {
+        printf("%zu free blocks left after freeing everything\n",
+               (size_t)(info.ordblks - start_info.ordblks));
+        ret++;
+    }
+    if (info.uordblks != start_info.uordblks) {
+        printf("%zu bytes still in use after freeing everything\n",
+               (size_t)(info.uordblks - start_info.uordblks));
+        ret++;
+    }
+#endif
+
+    printf("%d blocks: fragmenting frees %ld ticks, merging frees %ld ticks\n", num_block,
+           (long)odd_ticks, (long)even_ticks);
+    return ret != 0;
+}
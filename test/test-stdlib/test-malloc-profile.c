@@ -0,0 +1,174 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent <agent@local>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Exercise the malloc-profile counters: heap usage and peak through
+ * malloc, realloc, memalign and free, the size histogram, sampled
+ * call sites and, with a tick source provided here, the latency
+ * histograms.
+ */
+
+#define _DEFAULT_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <malloc.h>
+#include <string.h>
+
+#ifdef __MALLOC_PROFILE
+
+static unsigned long ticks;
+
+unsigned long
+__malloc_profile_ticks(void)
+{
+    return ticks += 3;
+}
+
+#define NUM_BLOCK 64
+
+static void *blocks[NUM_BLOCK];
+
+static size_t
+hist_total(const size_t *hist, int n)
+{
+    size_t total = 0;
+    int    i;
+
+    for (i = 0; i < n; i++)
+        total += hist[i];
+    return total;
+}
+
+int
+main(void)
+{
+    struct malloc_profile p;
+    size_t                base, peak;
+    int                   i;
+    int                   ret = 0;
+
+    /* Make sure stdio buffers are allocated before the counters are cleared */
+    printf("malloc profile test\n");
+    fflush(stdout);
+
+    malloc_profile_reset();
+    malloc_profile(&p);
+    base = p.in_use;
+    if (p.nmalloc || p.nfree || p.peak != base) {
+        printf("reset left counters set\n");
+        ret = 1;
+    }
+
+    for (i = 0; i < NUM_BLOCK; i++) {
+        blocks[i] = malloc(16 + i * 8);
+        if (!blocks[i]) {
+            printf("malloc %d failed\n", i);
+            return 1;
+        }
+    }
+    blocks[0] = realloc(blocks[0], 4096);
+    free(blocks[1]);
+    blocks[1] = memalign(256, 100);
+    if (!blocks[0] || !blocks[1]) {
+        printf("realloc/memalign failed\n");
+        return 1;
+    }
+
+    malloc_profile(&p);
+    peak = p.peak;
+    if (p.in_use <= base + NUM_BLOCK * 16 + 4096) {
+        printf("in_use %zu too small\n", p.in_use);
+        ret = 1;
+    }
+    if (peak < p.in_use) {
+        printf("peak %zu below in_use %zu\n", peak, p.in_use);
+        ret = 1;
+    }
+    if (p.nmalloc < NUM_BLOCK + 1) {
+        printf("nmalloc %zu\n", p.nmalloc);
+        ret = 1;
+    }
+    if (hist_total(p.size_class, MALLOC_PROFILE_CLASSES) != p.nmalloc) {
+        printf("size histogram doesn't match nmalloc\n");
+        ret = 1;
+    }
+    if (hist_total(p.malloc_latency, MALLOC_PROFILE_LATENCY) != p.nmalloc) {
+        printf("malloc latency histogram doesn't match nmalloc\n");
+        ret = 1;
+    }
+    if (p.nsite != (p.nmalloc + MALLOC_PROFILE_SAMPLE - 1) / MALLOC_PROFILE_SAMPLE) {
+        printf("nsite %zu for %zu allocations\n", p.nsite, p.nmalloc);
+        ret = 1;
+    }
+    if (p.site[0].caller == NULL || p.site[0].size < 16) {
+        printf("site not recorded\n");
+        ret = 1;
+    }
+
+    for (i = 0; i < NUM_BLOCK; i++)
+        free(blocks[i]);
+
+    malloc_profile(&p);
+    if (p.in_use != base) {
+        printf("in_use %zu after free, expected %zu\n", p.in_use, base);
+        ret = 1;
+    }
+    if (p.peak != peak) {
+        printf("peak changed from %zu to %zu\n", peak, p.peak);
+        ret = 1;
+    }
+    if (p.nfree < NUM_BLOCK) {
+        printf("nfree %zu\n", p.nfree);
+        ret = 1;
+    }
+    if (hist_total(p.free_latency, MALLOC_PROFILE_LATENCY) < NUM_BLOCK) {
+        printf("free latency histogram too small\n");
+        ret = 1;
+    }
+
+    malloc_profile_dump();
+    return ret;
+}
+
+#else
+
+int
+main(void)
+{
+    printf("malloc profile not enabled\n");
+    return 77;
+}
+
+#endif
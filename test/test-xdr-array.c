@@ -0,0 +1,266 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Copyright © 2026 agent <agent@local>
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above
+ *    copyright notice, this list of conditions and the following
+ *    disclaimer in the documentation and/or other materials provided
+ *    with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Check that the bulk xdr_array/xdr_vector paths produce the same
+ * wire data as marshalling one element at a time, over aligned and
+ * unaligned xdrmem streams and over xdrrec streams with buffers small
+ * enough to force partial inline windows.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <rpc/types.h>
+#include <rpc/xdr.h>
+
+#define NELEM  1000
+#define WIRE   (NELEM * 8 + 64)
+
+static char    wire_bulk[WIRE + 8];
+static char    wire_ref[WIRE + 8];
+
+static char    rec_data[WIRE * 2];
+static size_t  rec_len;
+static size_t  rec_pos;
+
+static int
+rec_write(void *handle, void *buf, int len)
+{
+    (void)handle;
+    if (rec_len + (size_t)len > sizeof(rec_data))
+        return -1;
+    memcpy(rec_data + rec_len, buf, len);
+    rec_len += len;
+    return len;
+}
+
+static int
+rec_read(void *handle, void *buf, int len)
+{
+    (void)handle;
+    if ((size_t)len > rec_len - rec_pos)
+        len = rec_len - rec_pos;
+    if (len == 0)
+        return -1;
+    memcpy(buf, rec_data + rec_pos, len);
+    rec_pos += len;
+    return len;
+}
+
+struct type {
+    const char *name;
+    xdrproc_t   proc;
+    u_int       size;
+};
+
+static const struct type types[] = {
+    { "int32_t", (xdrproc_t)xdr_int32_t, sizeof(int32_t) },
+    { "u_int32_t", (xdrproc_t)xdr_u_int32_t, sizeof(u_int32_t) },
+    { "int", (xdrproc_t)xdr_int, sizeof(int) },
+    { "float", (xdrproc_t)xdr_float, sizeof(float) },
+#ifndef _DOUBLE_IS_32BITS
+    { "double", (xdrproc_t)xdr_double, sizeof(double) },
+#endif
+    { "int64_t", (xdrproc_t)xdr_int64_t, sizeof(int64_t) },
+    { "u_int64_t", (xdrproc_t)xdr_u_int64_t, sizeof(u_int64_t) },
+    { "hyper", (xdrproc_t)xdr_hyper, sizeof(quad_t) },
+    { "short", (xdrproc_t)xdr_short, sizeof(short) },
+};
+
+#define NTYPES (sizeof(types) / sizeof(types[0]))
+
+static union {
+    uint64_t u64[NELEM];
+    char     c[NELEM * 8];
+} src, dst;
+
+static void
+fill(const struct type *t)
+{
+    u_int i;
+
+    for (i = 0; i < NELEM; i++) {
+        char *e = src.c + i * t->size;
+        if (t->proc == (xdrproc_t)xdr_float)
+            *(float *)e = (float)i * 1.25f - 7.0f;
+#ifndef _DOUBLE_IS_32BITS
+        else if (t->proc == (xdrproc_t)xdr_double)
+            *(double *)e = (double)i * 1e10 - 3.5;
+#endif
+        else if (t->size == 8)
+            *(uint64_t *)e = 0x0123456789abcdefULL * (i + 1);
+        else if (t->size == 4)
+            *(uint32_t *)e = 0x9e3779b9U * (i + 1);
+        else
+            *(short *)e = (short)(i * 37 - 500);
+    }
+}
+
+/* Marshal the array element-by-element to get the reference encoding */
+static u_int
+encode_ref(const struct type *t, u_int n)
+{
+    XDR   xdrs;
+    u_int i;
+
+    xdrmem_create(&xdrs, wire_ref, WIRE, XDR_ENCODE);
+    if (!xdr_u_int(&xdrs, &n))
+        return 0;
+    for (i = 0; i < n; i++)
+        if (!(*t->proc)(&xdrs, src.c + i * t->size))
+            return 0;
+    return XDR_GETPOS(&xdrs);
+}
+
+static int
+check_mem(const struct type *t, u_int n, u_int offset)
+{
+    XDR    xdrs;
+    char  *buf = wire_bulk + offset;
+    char  *addr = src.c;
+    char  *out;
+    u_int  len, ref_len, count;
+    int    ret = 0;
+
+    ref_len = encode_ref(t, n);
+    if (!ref_len) {
+        printf("%s: reference encode failed\n", t->name);
+        return 1;
+    }
+
+    count = n;
+    xdrmem_create(&xdrs, buf, WIRE, XDR_ENCODE);
+    if (!xdr_array(&xdrs, &addr, &count, NELEM, t->size, t->proc)) {
+        printf("%s/%u/%u: xdr_array encode failed\n", t->name, n, offset);
+        return 1;
+    }
+    len = XDR_GETPOS(&xdrs);
+    if (len != ref_len || memcmp(buf, wire_ref, len) != 0) {
+        printf("%s/%u/%u: encode mismatch\n", t->name, n, offset);
+        ret = 1;
+    }
+
+    /* Too short a buffer must fail */
+    count = n;
+    xdrmem_create(&xdrs, buf, ref_len - 4, XDR_ENCODE);
+    if (n && xdr_array(&xdrs, &addr, &count, NELEM, t->size, t->proc)) {
+        printf("%s/%u/%u: short encode succeeded\n", t->name, n, offset);
+        ret = 1;
+    }
+
+    /* Decode into an allocated array */
+    out = NULL;
+    xdrmem_create(&xdrs, wire_ref, ref_len, XDR_DECODE);
+    if (!xdr_array(&xdrs, &out, &count, NELEM, t->size, t->proc)) {
+        printf("%s/%u/%u: xdr_array decode failed\n", t->name, n, offset);
+        return 1;
+    }
+    if (count != n || (n && memcmp(out, src.c, n * t->size) != 0)) {
+        printf("%s/%u/%u: decode mismatch\n", t->name, n, offset);
+        ret = 1;
+    }
+    xdrs.x_op = XDR_FREE;
+    xdr_array(&xdrs, &out, &count, NELEM, t->size, t->proc);
+
+    /* Decode a fixed vector from an unaligned copy */
+    memcpy(buf, wire_ref, ref_len);
+    memset(dst.c, 0, sizeof(dst.c));
+    xdrmem_create(&xdrs, buf + 4, ref_len - 4, XDR_DECODE);
+    if (!xdr_vector(&xdrs, dst.c, n, t->size, t->proc)
+        || memcmp(dst.c, src.c, n * t->size) != 0) {
+        printf("%s/%u/%u: xdr_vector decode mismatch\n", t->name, n, offset);
+        ret = 1;
+    }
+    return ret;
+}
+
+static int
+check_rec(const struct type *t, u_int n, u_int bufsize)
+{
+    XDR    xdrs;
+    char  *addr = src.c;
+    u_int  count = n;
+    int    ret = 0;
+
+    rec_len = rec_pos = 0;
+    xdrrec_create(&xdrs, bufsize, bufsize, NULL, rec_read, rec_write);
+    xdrs.x_op = XDR_ENCODE;
+    if (!xdr_array(&xdrs, &addr, &count, NELEM, t->size, t->proc)
+        || !xdrrec_endofrecord(&xdrs, TRUE)) {
+        printf("%s/%u/%u: xdrrec encode failed\n", t->name, n, bufsize);
+        ret = 1;
+    }
+    XDR_DESTROY(&xdrs);
+
+    memset(dst.c, 0, sizeof(dst.c));
+    xdrrec_create(&xdrs, bufsize, bufsize, NULL, rec_read, rec_write);
+    xdrs.x_op = XDR_DECODE;
+    addr = dst.c;
+    if (!xdrrec_skiprecord(&xdrs) || !xdr_array(&xdrs, &addr, &count, NELEM, t->size, t->proc)
+        || count != n || memcmp(dst.c, src.c, n * t->size) != 0) {
+        printf("%s/%u/%u: xdrrec decode mismatch\n", t->name, n, bufsize);
+        ret = 1;
+    }
+    XDR_DESTROY(&xdrs);
+    return ret;
+}
+
+static const u_int counts[] = { 0, 1, 2, 3, 255, 256, 257, NELEM };
+static const u_int bufsizes[] = { 100, 132, 4000 };
+
+#define NCOUNTS   (sizeof(counts) / sizeof(counts[0]))
+#define NBUFSIZES (sizeof(bufsizes) / sizeof(bufsizes[0]))
+
+int
+main(void)
+{
+    unsigned t, c, o;
+    int      ret = 0;
+
+    for (t = 0; t < NTYPES; t++) {
+        fill(&types[t]);
+        for (c = 0; c < NCOUNTS; c++) {
+            for (o = 0; o < 2; o++)
+                ret |= check_mem(&types[t], counts[c], o);
+            for (o = 0; o < NBUFSIZES; o++)
+                ret |= check_rec(&types[t], counts[c], bufsizes[o]);
+        }
+    }
+    if (ret == 0)
+        printf("xdr array tests passed\n");
+    return ret;
+}